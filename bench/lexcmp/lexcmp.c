@@ -0,0 +1,168 @@
+/*-
+ * Public Domain 2008-2013 WiredTiger, Inc.
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * lexcmp --
+ *	Check and time the key comparison routines on composite keys with long
+ * shared prefixes, against a byte-at-a-time reference implementation.
+ *
+ *	lexcmp [-n comparisons] [-p prefix length]
+ */
+#include <time.h>
+
+#include <wt_internal.h>
+
+#define	NKEYS	1024
+
+static uint8_t keybuf[NKEYS][128];
+static WT_ITEM keys[NKEYS];
+
+/*
+ * ref_compare --
+ *	Byte-at-a-time comparison, the reference for correctness and speed.
+ */
+static int
+ref_compare(const WT_ITEM *user_item, const WT_ITEM *tree_item)
+{
+	const uint8_t *userp, *treep;
+	uint32_t len, usz, tsz;
+
+	usz = user_item->size;
+	tsz = tree_item->size;
+	len = WT_MIN(usz, tsz);
+
+	for (userp = user_item->data, treep = tree_item->data;
+	    len > 0;
+	    --len, ++userp, ++treep)
+		if (*userp != *treep)
+			return (*userp < *treep ? -1 : 1);
+	return ((usz == tsz) ? 0 : (usz < tsz) ? -1 : 1);
+}
+
+static double
+elapsed(struct timespec *start)
+{
+	struct timespec now;
+
+	(void)clock_gettime(CLOCK_MONOTONIC, &now);
+	return ((double)(now.tv_sec - start->tv_sec) * 1e9 +
+	    (double)(now.tv_nsec - start->tv_nsec));
+}
+
+/*
+ * make_keys --
+ *	Build keys of 40-120 bytes: a shared prefix, then a few random bytes
+ * that occasionally match across keys.
+ */
+static void
+make_keys(u_int prefix)
+{
+	u_int i, j, size;
+
+	for (i = 0; i < NKEYS; ++i) {
+		size = 40 + (u_int)random() % 81;
+		for (j = 0; j < size; ++j)
+			keybuf[i][j] = j < prefix ?
+			    (uint8_t)('a' + j % 26) : (uint8_t)('a' + random() % 3);
+		keys[i].data = keybuf[i];
+		keys[i].size = size;
+	}
+}
+
+int
+main(int argc, char *argv[])
+{
+	struct timespec start;
+	uint64_t i, n;
+	uint32_t match;
+	u_int prefix;
+	int ch, cmp, sum;
+	const WT_ITEM *a, *b;
+
+	n = 20000000;
+	prefix = 32;
+	while ((ch = getopt(argc, argv, "n:p:")) != EOF)
+		switch (ch) {
+		case 'n':
+			n = (uint64_t)atoll(optarg);
+			break;
+		case 'p':
+			prefix = (u_int)atoi(optarg);
+			break;
+		default:
+			fprintf(stderr,
+			    "usage: lexcmp [-n comparisons] [-p prefix]\n");
+			return (EXIT_FAILURE);
+		}
+	make_keys(prefix);
+
+	/* Check every pair, with and without a known matching prefix. */
+	for (i = 0; i < NKEYS * NKEYS; ++i) {
+		a = &keys[i / NKEYS];
+		b = &keys[i % NKEYS];
+		cmp = ref_compare(a, b);
+		match = 0;
+		if (__wt_lex_compare(a, b) != cmp ||
+		    __wt_lex_compare_skip(a, b, &match) != cmp ||
+		    (cmp != 0 && (match >= WT_MIN(a->size, b->size) ?
+		    a->size == b->size :
+		    ((uint8_t *)a->data)[match] == ((uint8_t *)b->data)[match]))) {
+			fprintf(stderr, "lexcmp: comparison mismatch\n");
+			return (EXIT_FAILURE);
+		}
+		match = WT_MIN(match, prefix / 2);
+		if (__wt_lex_compare_skip(a, b, &match) != cmp) {
+			fprintf(stderr, "lexcmp: skip comparison mismatch\n");
+			return (EXIT_FAILURE);
+		}
+	}
+
+	sum = 0;
+	(void)clock_gettime(CLOCK_MONOTONIC, &start);
+	for (i = 0; i < n; ++i)
+		sum += ref_compare(
+		    &keys[i % NKEYS], &keys[(i * 7 + 1) % NKEYS]);
+	printf("byte-at-a-time:\t%.2f ns/compare\n", elapsed(&start) / (double)n);
+
+	(void)clock_gettime(CLOCK_MONOTONIC, &start);
+	for (i = 0; i < n; ++i)
+		sum += __wt_lex_compare(
+		    &keys[i % NKEYS], &keys[(i * 7 + 1) % NKEYS]);
+	printf("__wt_lex_compare:\t%.2f ns/compare\n", elapsed(&start) / (double)n);
+
+	(void)clock_gettime(CLOCK_MONOTONIC, &start);
+	for (i = 0; i < n; ++i) {
+		match = 0;
+		sum += __wt_lex_compare_skip(
+		    &keys[i % NKEYS], &keys[(i * 7 + 1) % NKEYS], &match);
+	}
+	printf("__wt_lex_compare_skip:\t%.2f ns/compare\n",
+	    elapsed(&start) / (double)n);
+
+	/* Use the result so the loops aren't optimized away. */
+	return (sum == INT_MAX ? EXIT_FAILURE : EXIT_SUCCESS);
+}
@@ -98,7 +98,11 @@ config_free(CONFIG *cfg)
 		}
 
 	free(cfg->popthreads);
-	free(cfg->uri);
+	if (cfg->uris != NULL) {
+		for (i = 0; i < cfg->table_count; i++)
+			free(cfg->uris[i]);
+		free(cfg->uris);
+	}
 	free(cfg->workers);
 	free(cfg->workload);
 }
@@ -118,10 +122,16 @@ config_threads(CONFIG *cfg, const char *config, size_t len)
 
 	wt_api = cfg->conn->get_extension_api(cfg->conn);
 
-	/* Allocate the workload array. */
+	/*
+	 * Allocate the workload array.  A later thread configuration (for
+	 * example, one given on the command line after an options file)
+	 * replaces any earlier one.
+	 */
+	free(cfg->workload);
 	if ((cfg->workload = calloc(WORKLOAD_MAX, sizeof(WORKLOAD))) == NULL)
 		return (enomem(cfg));
 	cfg->workload_cnt = 0;
+	cfg->workers_cnt = 0;
 
 	/*
 	 * The thread configuration may be in multiple groups, that is, we have
@@ -465,6 +475,11 @@ config_opt_str(CONFIG *cfg, const char *name, const char *value)
 int
 config_sanity(CONFIG *cfg)
 {
+	if (cfg->table_count < 1) {
+		fprintf(stderr, "table_count must be at least 1\n");
+		return (1);
+	}
+
 	/* Various intervals should be less than the run-time. */
 	if (cfg->run_time > 0 &&
 	    ((cfg->checkpoint_threads != 0 &&
@@ -490,6 +505,7 @@ config_print(CONFIG *cfg)
 	printf("Workload configuration:\n");
 	printf("\tHome: %s\n", cfg->home);
 	printf("\tTable name: %s\n", cfg->table_name);
+	printf("\tTable count: %" PRIu32 "\n", cfg->table_count);
 	printf("\tConnection configuration: %s\n", cfg->conn_config);
 
 	printf("\t%s table: %s\n",
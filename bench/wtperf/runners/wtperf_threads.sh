@@ -0,0 +1,79 @@
+#!/bin/bash
+
+# A script for running a wtperf workload with increasing numbers of worker
+# threads, to analyze how throughput scales.  Each run replaces the threads
+# configuration of the options file with the given number of threads doing
+# the given operation, for example:
+#
+#	wtperf_threads.sh -b ../ -t "1 2 4 8 16" insert-btree.wtperf
+
+# General configuration settings:
+BIN_DIR='.'
+ROOT_DIR=`/bin/pwd`
+OPERATION=inserts
+THREADS="1 2 4 8"
+OPTS=''
+
+USAGE="Usage: `basename $0` [-h] [-b binary dir] [-o wtperf options] [-p operation] [-r root dir] [-t thread counts] optfile"
+
+# Parse command line options.
+while getopts b:ho:p:r:t: OPT; do
+    case "$OPT" in
+        b)
+            BIN_DIR=$OPTARG
+            ;;
+        h)
+            echo $USAGE
+            exit 0
+            ;;
+        o)
+            OPTS="$OPTS -o $OPTARG"
+            ;;
+        p)
+            OPERATION=$OPTARG
+            ;;
+        r)
+            ROOT_DIR=$OPTARG
+            ;;
+        t)
+            THREADS=$OPTARG
+            ;;
+        \?)
+            # getopts issues an error message
+            echo $USAGE >&2
+            exit 1
+            ;;
+    esac
+done
+shift $((OPTIND-1))
+if [ $# -ne 1 ]; then
+	echo $USAGE >&2
+	exit 1
+fi
+OPTFILE=$1
+
+WTPERF=${BIN_DIR}/wtperf
+if [ ! -x $WTPERF ]; then
+	echo "Could not find or execute $WTPERF"
+	exit 1
+fi
+
+DB_HOME="$ROOT_DIR/WT_TEST"
+OUT_DIR="$ROOT_DIR/results"
+rm -rf $OUT_DIR && mkdir $OUT_DIR
+
+# Run the benchmark once for each thread count, then report the operations
+# per second each run averaged over its run time.
+printf "%8s %12s %12s\n" threads operations ops/sec
+for t in $THREADS; do
+	rm -rf $DB_HOME && mkdir $DB_HOME
+	$WTPERF -O $OPTFILE $OPTS \
+	    -o "threads=((count=$t,$OPERATION=1))" -h $DB_HOME || exit 1
+	cp $DB_HOME/test.stat $OUT_DIR/threads_$t.res
+
+	secs=`sed -n 's/^Run completed: \([0-9]*\) seconds/\1/p' \
+	    $DB_HOME/test.stat`
+	ops=`sed -n "s/^Executed \([0-9]*\) ${OPERATION%s} operations.*/\1/p" \
+	    $DB_HOME/test.stat`
+	printf "%8d %12d %12d\n" $t $ops $((ops / secs))
+done
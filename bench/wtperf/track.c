@@ -45,6 +45,24 @@ sum_pop_ops(CONFIG *cfg)
 	return (total);
 }
 
+/*
+ * Return total checkpoint time (NS).
+ */
+uint64_t
+sum_ckpt_latency(CONFIG *cfg)
+{
+	CONFIG_THREAD *thread;
+	uint64_t total;
+	u_int i;
+
+	total = 0;
+
+	for (i = 0, thread = cfg->ckptthreads;
+	    thread != NULL && i < cfg->checkpoint_threads; ++i, ++thread)
+		total += thread->ckpt.latency;
+	return (total);
+}
+
 /*
  * Return total checkpoint operations.
  */
@@ -30,7 +30,7 @@
 /* Default values. */
 static const CONFIG default_cfg = {
 	"WT_TEST",			/* home */
-	NULL,				/* uri */
+	NULL,				/* uris */
 	NULL,				/* conn */
 	NULL,				/* logf */
 	NULL, NULL,			/* populate, checkpoint threads */
@@ -194,9 +194,10 @@ worker(void *arg)
 	CONFIG_THREAD *thread;
 	TRACK *trk;
 	WT_CONNECTION *conn;
-	WT_CURSOR *cursor;
+	WT_CURSOR *cursor, **cursors;
 	WT_SESSION *session;
 	uint64_t next_val, nsecs;
+	uint32_t i;
 	int measure_latency, ret;
 	uint8_t *op, *op_end;
 	char *value_buf, *key_buf, *value;
@@ -205,17 +206,23 @@ worker(void *arg)
 	cfg = thread->cfg;
 	conn = cfg->conn;
 	session = NULL;
+	cursors = NULL;
 
 	if ((ret = conn->open_session(conn, NULL, NULL, &session)) != 0) {
 		lprintf(cfg, ret, 0, "worker: WT_CONNECTION.open_session");
 		goto err;
 	}
-	if ((ret = session->open_cursor(
-	    session, cfg->uri, NULL, NULL, &cursor)) != 0) {
-		lprintf(cfg,
-		    ret, 0, "worker: WT_SESSION.open_cursor: %s", cfg->uri);
+	if ((cursors = calloc(cfg->table_count, sizeof(*cursors))) == NULL) {
+		ret = enomem(cfg);
 		goto err;
 	}
+	for (i = 0; i < cfg->table_count; i++)
+		if ((ret = session->open_cursor(session,
+		    cfg->uris[i], NULL, NULL, &cursors[i])) != 0) {
+			lprintf(cfg, ret, 0,
+			    "worker: WT_SESSION.open_cursor: %s", cfg->uris[i]);
+			goto err;
+		}
 
 	key_buf = thread->key_buf;
 	value_buf = thread->value_buf;
@@ -258,6 +265,7 @@ worker(void *arg)
 		}
 
 		sprintf(key_buf, "%0*" PRIu64, cfg->key_sz, next_val);
+		cursor = cursors[next_val % cfg->table_count];
 		measure_latency = cfg->sample_interval != 0 && (
 		    trk->ops % cfg->sample_rate == 0);
 		if (measure_latency &&
@@ -358,6 +366,7 @@ op_err:			lprintf(cfg, ret, 0,
 err:		g_error = g_stop = 1;
 	}
 
+	free(cursors);
 	return (NULL);
 }
 
@@ -470,9 +479,9 @@ populate_thread(void *arg)
 	CONFIG *cfg;
 	CONFIG_THREAD *thread;
 	WT_CONNECTION *conn;
-	WT_CURSOR *cursor;
+	WT_CURSOR *cursor, **cursors;
 	WT_SESSION *session;
-	uint32_t opcount;
+	uint32_t i, opcount;
 	uint64_t op;
 	int intxn, ret;
 	char *value_buf, *key_buf;
@@ -481,6 +490,7 @@ populate_thread(void *arg)
 	cfg = thread->cfg;
 	conn = cfg->conn;
 	session = NULL;
+	cursors = NULL;
 	ret = 0;
 
 	key_buf = thread->key_buf;
@@ -492,12 +502,19 @@ populate_thread(void *arg)
 	}
 
 	/* Do a bulk load if populate is single-threaded. */
-	if ((ret = session->open_cursor(session, cfg->uri, NULL,
-	    cfg->populate_threads == 1 ? "bulk" : NULL, &cursor)) != 0) {
-		lprintf(cfg,
-		    ret, 0, "populate: WT_SESSION.open_cursor: %s", cfg->uri);
+	if ((cursors = calloc(cfg->table_count, sizeof(*cursors))) == NULL) {
+		ret = enomem(cfg);
 		goto err;
 	}
+	for (i = 0; i < cfg->table_count; i++)
+		if ((ret = session->open_cursor(session, cfg->uris[i], NULL,
+		    cfg->populate_threads == 1 ? "bulk" : NULL,
+		    &cursors[i])) != 0) {
+			lprintf(cfg, ret, 0,
+			    "populate: WT_SESSION.open_cursor: %s",
+			    cfg->uris[i]);
+			goto err;
+		}
 
 	/* Populate the database. */
 	if (cfg->populate_ops_per_txn == 0)
@@ -507,6 +524,7 @@ populate_thread(void *arg)
 				break;
 
 			sprintf(key_buf, "%0*" PRIu64, cfg->key_sz, op);
+			cursor = cursors[op % cfg->table_count];
 			cursor->set_key(cursor, key_buf);
 			cursor->set_value(cursor, value_buf);
 			if ((ret = cursor->insert(cursor)) != 0) {
@@ -531,6 +549,7 @@ populate_thread(void *arg)
 				intxn = 1;
 			}
 			sprintf(key_buf, "%0*" PRIu64, cfg->key_sz, op);
+			cursor = cursors[op % cfg->table_count];
 			cursor->set_key(cursor, key_buf);
 			cursor->set_value(cursor, value_buf);
 			if ((ret = cursor->insert(cursor)) != 0) {
@@ -565,6 +584,7 @@ populate_thread(void *arg)
 err:		g_error = g_stop = 1;
 	}
 
+	free(cursors);
 	return (NULL);
 }
 
@@ -681,6 +701,7 @@ checkpoint_worker(void *arg)
 	WT_CONNECTION *conn;
 	WT_SESSION *session;
 	struct timespec e, s;
+	uint64_t nsecs;
 	uint32_t i;
 	int ret;
 
@@ -722,6 +743,9 @@ checkpoint_worker(void *arg)
 			lprintf(cfg, ret, 0, "Get time failed in checkpoint.");
 			goto err;
 		}
+		nsecs = (uint64_t)(e.tv_nsec - s.tv_nsec);
+		nsecs += sec_to_ns((uint64_t)(e.tv_sec - s.tv_sec));
+		thread->ckpt.latency += nsecs;
 	}
 
 	if (session != NULL &&
@@ -746,7 +770,7 @@ execute_populate(CONFIG *cfg)
 	struct timespec start, stop;
 	double secs;
 	uint64_t last_ops;
-	uint32_t interval;
+	uint32_t i, interval;
 	int elapsed, ret;
 
 	session = NULL;
@@ -823,11 +847,13 @@ execute_populate(CONFIG *cfg)
 			return (ret);
 		}
 		lprintf(cfg, 0, 1, "Compact after populate");
-		if ((ret = session->compact(session, cfg->uri, NULL)) != 0) {
-			lprintf(cfg, ret, 0,
-			     "execute_populate: WT_SESSION.compact");
-			return (ret);
-		}
+		for (i = 0; i < cfg->table_count; i++)
+			if ((ret = session->compact(
+			    session, cfg->uris[i], NULL)) != 0) {
+				lprintf(cfg, ret, 0,
+				     "execute_populate: WT_SESSION.compact");
+				return (ret);
+			}
 		if ((ret = session->close(session, NULL)) != 0) {
 			lprintf(cfg, ret, 0,
 			     "execute_populate: WT_SESSION.close");
@@ -969,33 +995,54 @@ find_table_count(CONFIG *cfg)
 	WT_CONNECTION *conn;
 	WT_CURSOR *cursor;
 	WT_SESSION *session;
+	uint32_t i, max_icount;
 	char *key;
 	int ret, t_ret;
 
 	conn = cfg->conn;
+	max_icount = 0;
 
 	if ((ret = conn->open_session(conn, NULL, NULL, &session)) != 0) {
 		lprintf(cfg, ret, 0,
 		    "open_session failed finding existing table count");
 		goto err;
 	}
-	if ((ret = session->open_cursor(session, cfg->uri,
-	    NULL, NULL, &cursor)) != 0) {
-		lprintf(cfg, ret, 0,
-		    "open_cursor failed finding existing table count");
-		goto err;
+
+	/* Keys are spread across the tables, find the largest. */
+	for (i = 0; i < cfg->table_count; i++) {
+		if ((ret = session->open_cursor(session, cfg->uris[i],
+		    NULL, NULL, &cursor)) != 0) {
+			lprintf(cfg, ret, 0,
+			    "open_cursor failed finding existing table count");
+			goto err;
+		}
+		if ((ret = cursor->prev(cursor)) == WT_NOTFOUND) {
+			ret = cursor->close(cursor);
+			continue;
+		}
+		if (ret != 0) {
+			lprintf(cfg, ret, 0,
+			    "cursor prev failed finding existing table count");
+			goto err;
+		}
+		if ((ret = cursor->get_key(cursor, &key)) != 0) {
+			lprintf(cfg, ret, 0,
+			    "cursor get_key failed finding existing table "
+			    "count");
+			goto err;
+		}
+		if ((uint32_t)atoi(key) > max_icount)
+			max_icount = (uint32_t)atoi(key);
+		if ((ret = cursor->close(cursor)) != 0)
+			goto err;
 	}
-	if ((ret = cursor->prev(cursor)) != 0) {
+	if (max_icount == 0) {
+		ret = WT_NOTFOUND;
 		lprintf(cfg, ret, 0,
 		    "cursor prev failed finding existing table count");
 		goto err;
 	}
-	if ((ret = cursor->get_key(cursor, &key)) != 0) {
-		lprintf(cfg, ret, 0,
-		    "cursor get_key failed finding existing table count");
-		goto err;
-	}
-	cfg->icount = (uint32_t)atoi(key);
+	cfg->icount = max_icount;
 
 err:	if ((t_ret = session->close(session, NULL)) != 0) {
 		if (ret == 0)
@@ -1014,6 +1061,7 @@ main(int argc, char *argv[])
 	pthread_t monitor_thread;
 	size_t len;
 	uint64_t req_len, total_ops;
+	uint32_t i;
 	int ch, monitor_created, ret, t_ret;
 	const char *opts = "C:O:T:h:o:SML";
 	const char *wtperftmp_subdir = "wtperftmp";
@@ -1121,13 +1169,27 @@ main(int argc, char *argv[])
 			break;
 		}
 
-	/* Build the URI from the table name. */
-	req_len = strlen("table:") + strlen(cfg->table_name) + 1;
-	if ((cfg->uri = calloc(req_len, 1)) == NULL) {
+	/*
+	 * Build the URIs from the table name: a single table uses the table
+	 * name, multiple tables append the table number.
+	 */
+	if ((cfg->uris = calloc(cfg->table_count, sizeof(char *))) == NULL) {
 		ret = enomem(cfg);
 		goto err;
 	}
-	snprintf(cfg->uri, req_len, "table:%s", cfg->table_name);
+	req_len = strlen("table:") + strlen(cfg->table_name) + 20;
+	for (i = 0; i < cfg->table_count; i++) {
+		if ((cfg->uris[i] = calloc(req_len, 1)) == NULL) {
+			ret = enomem(cfg);
+			goto err;
+		}
+		if (cfg->table_count == 1)
+			snprintf(cfg->uris[i],
+			    req_len, "table:%s", cfg->table_name);
+		else
+			snprintf(cfg->uris[i], req_len,
+			    "table:%s%05" PRIu32, cfg->table_name, i);
+	}
 	
 	if ((ret = setup_log_file(cfg)) != 0)
 		goto err;
@@ -1202,12 +1264,13 @@ main(int argc, char *argv[])
 			    "Error opening a session on %s", cfg->home);
 			goto err;
 		}
-		if ((ret = session->create(
-		    session, cfg->uri, cfg->table_config)) != 0) {
-			lprintf(cfg,
-			    ret, 0, "Error creating table %s", cfg->uri);
-			goto err;
-		}
+		for (i = 0; i < cfg->table_count; i++)
+			if ((ret = session->create(session,
+			    cfg->uris[i], cfg->table_config)) != 0) {
+				lprintf(cfg, ret, 0,
+				    "Error creating table %s", cfg->uris[i]);
+				goto err;
+			}
 		if ((ret = session->close(session, NULL)) != 0) {
 			lprintf(cfg,
 			    ret, 0, "Error closing session");
@@ -1271,6 +1334,11 @@ main(int argc, char *argv[])
 		lprintf(cfg, 0, 1,
 		    "Executed %" PRIu64 " checkpoint operations",
 		    g_ckpt_ops);
+		if (g_ckpt_ops != 0)
+			lprintf(cfg, 0, 1,
+			    "Checkpoint average time: %" PRIu64 " ms",
+			    (uint64_t)ns_to_ms(
+			    sum_ckpt_latency(cfg) / g_ckpt_ops));
 
 		latency_print(cfg);
 	}
@@ -63,7 +63,7 @@ typedef struct {
 
 struct __config {			/* Configuration struction */
 	const char *home;		/* WiredTiger home */
-	char *uri;			/* Object URI */
+	char **uris;			/* Object URIs */
 
 	WT_CONNECTION *conn;		/* Database connection */
 
@@ -175,6 +175,7 @@ int	 enomem(const CONFIG *);
 void	 lprintf(const CONFIG *, int err, uint32_t, const char *, ...)
 	   WT_GCC_ATTRIBUTE((format (printf, 4, 5)));
 int	 setup_log_file(CONFIG *);
+uint64_t sum_ckpt_latency(CONFIG *);
 uint64_t sum_ckpt_ops(CONFIG *);
 uint64_t sum_insert_ops(CONFIG *);
 uint64_t sum_pop_ops(CONFIG *);
@@ -124,6 +124,8 @@ DEF_OPT_AS_STRING(threads, "", "worker thread configuration: each 'count' "
 DEF_OPT_AS_CONFIG_STRING(transaction_config, "",
     "transaction configuration string, relevant when populate_opts_per_txn "
     "is nonzero")
+DEF_OPT_AS_UINT32(table_count, 1,
+    "number of tables, keys are spread evenly across the tables")
 DEF_OPT_AS_STRING(table_name, "test", "table name")
 DEF_OPT_AS_UINT32(verbose, 1, "verbosity")
 
@@ -218,6 +218,12 @@ file_config = format_meta + [
 	    data, that is, the limit is applied before any block compression
 	    is done''',
 	    min='512B', max='512MB'),
+	Config('leaf_hash_index', 'false', r'''
+	    build an in-memory hash table of keys for row-store leaf pages
+	    searched often, so searches for keys on the page don't binary
+	    search it (ignored for custom collators); see @ref
+	    tuning_search_index for more information''',
+	    type='boolean'),
 	Config('leaf_item_max', '0', r'''
 	    the largest key or value stored within a leaf node, in bytes.
 	    If non-zero, any key or value larger than the specified size
@@ -250,6 +256,13 @@ file_config = format_meta + [
 	    minimum gain before prefix compression will be used on row-store
 	    leaf pages''',
 	    min=0),
+	Config('read_ahead', '0', r'''
+	    the maximum number of sibling pages read ahead of cursor scans.
+	    If non-zero, once a cursor scan reads sibling pages from disk
+	    in order, the following pages are scheduled to be read in the
+	    background, in a window that grows to this many pages; see
+	    @ref tuning_read_ahead for more information''',
+	    min=0, max=1024),
 	Config('split_pct', '75', r'''
 	    the Btree page split size as a percentage of the maximum Btree
 	    page size, that is, when a Btree page is split, it will be
@@ -316,6 +329,28 @@ connection_runtime_config = [
 	    min='1MB', max='10TB'),
 	Config('error_prefix', '', r'''
 	    prefix string for error messages'''),
+	Config('eviction', '', r'''
+	    eviction configuration options''',
+	    type='category', subconfig=[
+	    Config('scan_resistant', 'false', r'''
+	        protect pages that have been used more than once from eviction:
+	        pages are read into a probationary part of the cache, and only
+	        move to the protected part when they are used again.  When the
+	        probationary part holds more than a quarter of the cache, its
+	        pages are evicted first, so scanning a large object does not
+	        evict the application's working set''',
+	        type='boolean'),
+	    Config('threads_max', '1', r'''
+	        maximum number of threads WiredTiger will use to evict pages
+	        from the cache, including the eviction server thread.  Threads
+	        beyond \c threads_min are started as the eviction load
+	        requires and stopped once eviction catches up''',
+	        min=1, max=20),
+	    Config('threads_min', '1', r'''
+	        minimum number of threads WiredTiger will use to evict pages
+	        from the cache, including the eviction server thread''',
+	        min=1, max=20),
+	    ]),
 	Config('eviction_dirty_target', '80', r'''
 	    continue evicting until the cache has less dirty pages than this
 	    (as a percentage). Dirty pages will only be evicted if the cache
@@ -467,6 +502,11 @@ methods = {
 	    ignore the encodings for the key and value, manage data as if
 	    the formats were \c "u".  See @ref cursor_raw for details''',
 	    type='boolean'),
+	Config('scan', 'false', r'''
+	    hint that the cursor will be used to scan the object: pages the
+	    cursor reads into the cache are evicted first, and pages it visits
+	    are not treated as recently used''',
+	    type='boolean'),
 	Config('statistics', '', r'''
 	    Specify the statistics to be gathered.  Choosing "all" gathers
 	    statistics regardless of cost and may include traversing
@@ -491,6 +531,7 @@ methods = {
 	    type='list'),
 ]),
 
+'session.prefetch' : Method([]),
 'session.rename' : Method([]),
 'session.salvage' : Method([
 	Config('force', 'false', r'''
@@ -580,16 +621,70 @@ methods = {
 'session.reconfigure' : Method(session_config),
 
 'wiredtiger_open' : Method(connection_runtime_config + [
+	Config('async_io', '', r'''
+	    write data file blocks asynchronously, waiting for the writes
+	    to complete only when files are checkpointed, flushed or
+	    closed.  Requires Linux native AIO, see @ref tuning_async_io
+	    for more information''',
+	    type='category', subconfig=[
+	    Config('enabled', 'false', r'''
+	        enable asynchronous writes''',
+	        type='boolean'),
+	    Config('queue_depth', '32', r'''
+	        maximum number of asynchronous writes in flight for each
+	        file''',
+	        min='1', max='1024'),
+	    ]),
+	Config('block_cache', '', r'''
+	    keep the images of clean pages evicted from the cache in a
+	    secondary in-memory cache, so reading the pages again doesn't
+	    require reading or decompressing blocks.  See @ref
+	    tuning_block_cache for more information''',
+	    type='category', subconfig=[
+	    Config('size', '0', r'''
+	        maximum heap memory to allocate for page images; \c 0
+	        disables the block cache''',
+	        min='0', max='10TB'),
+	    ]),
 	Config('buffer_alignment', '-1', r'''
 	    in-memory alignment (in bytes) for buffers used for I/O.  The
 	    default value of -1 indicates a platform-specific alignment
 	    value should be used (4KB on Linux systems, zero elsewhere)''',
 	    min='-1', max='1MB'),
+	Config('buffer_pool', '', r'''
+	    keep freed I/O buffers in a pool shared by all sessions and
+	    re-use them for block reads and writes, rather than allocating
+	    and freeing aligned memory for each I/O.  See @ref
+	    tuning_buffer_pool for more information''',
+	    type='category', subconfig=[
+	    Config('size', '0', r'''
+	        maximum heap memory to hold in free buffers; \c 0 disables
+	        the buffer pool''',
+	        min='0', max='10TB'),
+	    ]),
 	Config('checkpoint', '', r'''
 	    periodically checkpoint the database''',
 	    type='category', subconfig=[
+	    Config('incremental', 'false', r'''
+	        write dirty pages between periodic checkpoints, at a rate
+	        that would write the cache's dirty data before the next
+	        checkpoint, so each checkpoint has less to write.  See @ref
+	        tuning_checkpoint_incremental for more information''',
+	        type='boolean'),
+	    Config('max_mb_per_sec', '0', r'''
+	        maximum rate at which checkpoints write data files, in MB per
+	        second, including checkpoints taken by the application; \c 0
+	        means checkpoints are not throttled.  See @ref
+	        tuning_checkpoint_throttle for more information''',
+	        min='0'),
 	    Config('name', '"WiredTigerCheckpoint"', r'''
 	        the checkpoint name'''),
+	    Config('threads', '0', r'''
+	        additional threads used to write and flush files during
+	        database checkpoints, including checkpoints taken by the
+	        application.  See @ref tuning_checkpoint_threads for more
+	        information''',
+	        min='0', max='8'),
 	    Config('wait', '0', r'''
 	        seconds to wait between each checkpoint; setting this value
 	        configures periodic checkpoints''',
@@ -631,16 +726,36 @@ methods = {
 	    Config('archive', 'true', r'''
 	        automatically archive unneeded log files''',
 	        type='boolean'),
+	    Config('compressor', '', r'''
+	        configure a compressor for log records.  Permitted values are
+	        empty (off) or \c "bzip2", \c "snappy" or custom compression
+	        engine \c "name" created with WT_CONNECTION::add_compressor.
+	        See @ref compression for more information'''),
 	    Config('enabled', 'false', r'''
 	        enable logging subsystem''',
 	        type='boolean'),
 	    Config('file_max', '100MB', r'''
 	        the maximum size of log files''',
 	        min='100KB', max='2GB'),
+	    Config('group_commit_usecs', '0', r'''
+	        if non-zero, a separate thread syncs the log for transactions
+	        committing with <code>transaction_sync=fsync</code>, waiting
+	        this many microseconds for other commits to join each sync''',
+	        min='0', max='1000000'),
+	    Config('prealloc', '0', r'''
+	        number of log files a separate thread keeps created and
+	        allocated, ready for use when the log switches files''',
+	        min='0', max='16'),
 	    Config('path', '""', r'''
 	        the path to a directory into which the log files are written.
 	        If the value is not an absolute path name, the files are created
 	        relative to the database home'''),
+	    Config('recovery_threads', '0', r'''
+	        number of threads applying log records in parallel when
+	        recovery runs as the database is opened, each file's records
+	        are applied in order by a single thread.  If zero, the thread
+	        opening the database applies all of the log records''',
+	        min='0', max='8'),
 	    ]),
 	Config('lsm_merge', 'true', r'''
 	    merge LSM chunks where possible''',
@@ -653,6 +768,17 @@ methods = {
 	    RPC server for primary processes and use RPC for secondary
 	    processes). <b>Not yet supported in WiredTiger</b>''',
 	    type='boolean'),
+	Config('prefetch', '', r'''
+	    prefetch configuration.  Prefetch threads read pages queued by
+	    cursor scan read-ahead, compaction and WT_SESSION::prefetch into
+	    the cache in the background.  See @ref tuning_prefetch for more
+	    information''',
+	    type='category', subconfig=[
+	    Config('threads', '0', r'''
+	        number of prefetch threads; the default of 0 disables
+	        prefetch''',
+	        min='0', max='8'), # !!! max must match WT_PREFETCH_MAX
+	    ]),
 	Config('session_max', '50', r'''
 	    maximum expected number of sessions (including server
 	    threads)''',
@@ -688,5 +814,17 @@ methods = {
 	    variables regardless of whether or not the process is running
 	    with special privileges.  See @ref home for more information''',
 	    type='boolean'),
+	Config('write_behind', '', r'''
+	    write-behind configuration.  Write-behind threads write dirty leaf
+	    pages in the background when the cache holds more than half the
+	    \c eviction_dirty_target percentage of dirty data, so eviction
+	    mostly finds clean pages it can discard without writing them.
+	    See @ref cache_eviction for more information''',
+	    type='category', subconfig=[
+	    Config('threads', '0', r'''
+	        number of write-behind threads; the default of 0 disables
+	        write-behind''',
+	        min='0', max='8'),
+	    ]),
 ]),
 }
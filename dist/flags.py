@@ -41,6 +41,7 @@ flags = {
 		'TREE_COMPACT',
 		'TREE_DISCARD',
 		'TREE_EVICT',
+		'TREE_PREFETCH',
 		'TREE_PREV',
 		'TREE_SKIP_INTL',
 		'TREE_SKIP_LEAF',
@@ -86,6 +87,7 @@ flags = {
 		'CONN_SERVER_RUN',
 	],
 	'session' : [
+		'SESSION_CHECKPOINT',
 		'SESSION_INTERNAL',
 		'SESSION_LOGGING_DISABLED',
 		'SESSION_LOGGING_INMEM',
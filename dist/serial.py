@@ -4,21 +4,27 @@ import textwrap
 from dist import compare_srcfile
 
 class SerialArg:
-	def __init__(self, typestr, name, sized=0):
+	def __init__(self, typestr, name, sized=0, worker=1):
 		self.typestr = typestr
 		self.name = name
 		self.sized = sized
+		self.worker = worker
 
+# Serialized functions acquire the page's spinlock before calling the worker
+# function, unless the worker function does its own synchronization, in which
+# case it's passed the page.
 class Serial:
-	def __init__(self, name, args):
+	def __init__(self, name, args, lock=1):
 		self.name = name
 		self.args = args
+		self.lock = lock
 
 msgtypes = [
 Serial('col_append', [
 		SerialArg('WT_INSERT_HEAD *', 'ins_head'),
 		SerialArg('WT_INSERT ***', 'ins_stack'),
 		SerialArg('WT_INSERT *', 'new_ins', 1),
+		SerialArg('WT_UPDATE *', 'new_upd', 1, 0),
 		SerialArg('uint64_t *', 'recnop'),
 		SerialArg('u_int', 'skipdepth'),
 	]),
@@ -27,13 +33,14 @@ Serial('insert', [
 		SerialArg('WT_INSERT_HEAD *', 'ins_head'),
 		SerialArg('WT_INSERT ***', 'ins_stack'),
 		SerialArg('WT_INSERT *', 'new_ins', 1),
+		SerialArg('WT_UPDATE *', 'new_upd', 1, 0),
 		SerialArg('u_int', 'skipdepth'),
-	]),
+	], 0),
 
 Serial('update', [
 		SerialArg('WT_UPDATE **', 'srch_upd'),
 		SerialArg('WT_UPDATE *', 'upd', 1),
-	]),
+	], 0),
 ]
 
 # decl --
@@ -58,32 +65,35 @@ def decl_p(l):
 def output(entry, f):
 	# Function declaration.
 	f.write('static inline int\n__wt_' + entry.name + '_serial(\n')
+	# Don't wrap lines between a declaration's type and name.
 	o = 'WT_SESSION_IMPL *session, WT_PAGE *page'
 	for l in entry.args:
 		if l.sized:
-			o += ', ' + decl_p(l) + ', size_t ' + l.name + '_size'
+			o += ', ' + decl_p(l).replace(' ', '\0') + \
+			    ', size_t\0' + l.name + '_size'
 		else:
-			o += ', ' + decl(l)
+			o += ', ' + decl(l).replace(' ', '\0')
 	o += ')'
-	f.write('\n'.join('\t' + l for l in textwrap.wrap(o, 70)))
+	f.write('\n'.join('\t' + l.replace('\0', ' ')
+	    for l in textwrap.wrap(o, 70)))
 	f.write('\n{')
 
 	# Local variable declarations.
 	for l in entry.args:
 		if l.sized:
 			f.write('''
-\t''' + decl(l) + ''' = *''' + l.name + '''p;
+\t''' + decl(l) + ''' = *''' + l.name + '''p;''')
+	f.write('''
 \tWT_DECL_RET;
-\tsize_t incr_mem;
 ''')
 
 	# Clear memory references we now own.
-	for l in entry.args:
-		if l.sized:
-			f.write('''
+	f.write('''
 \t/* Clear references to memory we now own. */
-\t*''' + l.name + '''p = NULL;
 ''')
+	for l in entry.args:
+		if l.sized:
+			f.write('\t*' + l.name + 'p = NULL;\n')
 
 	# Check the page write generation hasn't wrapped.
 	f.write('''
@@ -103,7 +113,7 @@ def output(entry, f):
 ''')
 
 	# Call the worker function.
-	if entry.name != "update":
+	if entry.lock:
 		f.write('''
 \t/* Acquire the page's spinlock, call the worker function. */
 \tWT_PAGE_LOCK(session, page);''')
@@ -112,14 +122,15 @@ def output(entry, f):
 \tret = __''' + entry.name + '''_serial_func(
 ''')
 	o = 'session'
-	if entry.name == "update":
+	if not entry.lock:
 		o += ', page'
 	for l in entry.args:
-		o += ', ' + l.name
+		if l.worker:
+			o += ', ' + l.name
 	o += ');'
 	f.write('\n'.join('\t    ' + l for l in textwrap.wrap(o, 70)))
 
-	if entry.name != "update":
+	if entry.lock:
 		f.write('''
 \tWT_PAGE_UNLOCK(session, page);''')
 
@@ -131,32 +142,16 @@ def output(entry, f):
 	for l in entry.args:
 		if not l.sized:
 			continue
-		f.write(
-		    '\t\t__wt_free(session, ' + l.name + ');\n')
+		f.write('\t\t__wt_page_arena_free(session, page, ' +
+		    l.name + ', ' + l.name + '_size);\n')
 	f.write('''
 \t\treturn (ret);
 \t}
 ''')
 
+	# The page's arena chunks are charged to its footprint as they're
+	# allocated, there's no footprint to update here.
 	f.write('''
-\t/*
-\t * Increment in-memory footprint after releasing the mutex: that's safe
-\t * because the structures we added cannot be discarded while visible to
-\t * any running transaction, and we're a running transaction, which means
-\t * there can be no corresponding delete until we complete.
-\t */
-\tincr_mem = 0;
-''')
-	for l in entry.args:
-		if not l.sized:
-			continue
-		f.write('\tWT_ASSERT(session, ' +
-		    l.name + '_size != 0);\n')
-		f.write('\tincr_mem += ' + l.name + '_size;\n')
-	f.write('''\tif (incr_mem != 0)
-\t\t__wt_cache_page_inmem_incr(session, page, incr_mem);
-
-\t/* Mark the page dirty after updating the footprint. */
 \t__wt_page_modify_set(session, page);
 
 \treturn (0);
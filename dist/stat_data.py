@@ -30,6 +30,10 @@ connection_stats = [
 	##########################################
 	# System statistics
 	##########################################
+	Stat('buffer_pool_alloc', 'I/O buffer pool: buffers allocated'),
+	Stat('buffer_pool_bytes',
+	    'I/O buffer pool: bytes currently held', 'no_clear,no_scale'),
+	Stat('buffer_pool_reuse', 'I/O buffer pool: buffers re-used'),
 	Stat('cond_wait', 'pthread mutex condition wait calls'),
 	Stat('file_open', 'files currently open', 'no_clear,no_scale'),
 	Stat('memory_allocation', 'memory allocations'),
@@ -46,22 +50,54 @@ connection_stats = [
 	Stat('block_byte_map_read', 'block manager: mapped bytes read'),
 	Stat('block_byte_read', 'block manager: bytes read'),
 	Stat('block_byte_write', 'block manager: bytes written'),
+	Stat('block_cache_bytes',
+	    'block manager: block cache bytes currently held',
+	    'no_clear,no_scale'),
+	Stat('block_cache_evict',
+	    'block manager: block cache page images discarded'),
+	Stat('block_cache_hit', 'block manager: block cache hits'),
+	Stat('block_cache_insert',
+	    'block manager: block cache page images added'),
+	Stat('block_cache_miss', 'block manager: block cache misses'),
+	Stat('block_ckpt_throttle',
+	    'block manager: checkpoint writes throttled'),
+	Stat('block_ckpt_throttle_time',
+	    'block manager: checkpoint write throttle time (usecs)'),
 	Stat('block_map_read', 'block manager: mapped blocks read'),
 	Stat('block_preload', 'block manager: blocks pre-loaded'),
 	Stat('block_read', 'block manager: blocks read'),
+	Stat('block_remap', 'block manager: file mappings extended'),
 	Stat('block_write', 'block manager: blocks written'),
+	Stat('block_write_async',
+	    'block manager: blocks written asynchronously'),
+	Stat('block_write_async_wait',
+	    'block manager: waits for asynchronous writes to complete'),
 
 	##########################################
 	# Cache and eviction statistics
 	##########################################
+	Stat('cache_arena_chunk', 'cache: page arena chunks allocated'),
+	Stat('cache_arena_reuse', 'cache: page arena structures reused'),
+	Stat('cache_bytes_clean_eviction',
+	    'cache: dirty bytes cleaned by eviction'),
+	Stat('cache_bytes_clean_write_behind',
+	    'cache: dirty bytes cleaned by write-behind threads'),
 	Stat('cache_bytes_dirty',
 	    'cache: tracked dirty bytes in the cache', 'no_scale'),
 	Stat('cache_bytes_inuse',
 	    'cache: bytes currently in the cache', 'no_clear,no_scale'),
 	Stat('cache_bytes_max',
 	    'cache: maximum bytes configured', 'no_clear,no_scale'),
+	Stat('cache_bytes_probation',
+	    'cache: bytes in the probationary part of the cache',
+	    'no_clear,no_scale'),
+	Stat('cache_bytes_protected',
+	    'cache: bytes in the protected part of the cache',
+	    'no_clear,no_scale'),
 	Stat('cache_bytes_read', 'cache: bytes read into cache'),
 	Stat('cache_bytes_write', 'cache: bytes written from cache'),
+	Stat('cache_eviction_app',
+	    'cache: pages evicted by application threads'),
 	Stat('cache_eviction_clean', 'cache: unmodified pages evicted'),
 	Stat('cache_eviction_dirty', 'cache: modified pages evicted'),
 	Stat('cache_eviction_checkpoint',
@@ -81,17 +117,45 @@ connection_stats = [
 	Stat('cache_eviction_merge_fail',
 	    'cache: internal page merge attempts that could not complete'),
 	Stat('cache_eviction_merge_levels', 'cache: internal levels merged'),
+	Stat('cache_eviction_server_evicting',
+	    'cache: pages evicted by the eviction server'),
 	Stat('cache_eviction_slow',
 	    'cache: eviction server unable to reach eviction goal'),
 	Stat('cache_eviction_walk', 'cache: pages walked for eviction'),
+	Stat('cache_eviction_worker_evicting',
+	    'cache: pages evicted by eviction worker threads'),
+	Stat('cache_eviction_worker_evicting_max',
+	    'cache: pages evicted by the busiest eviction worker thread',
+	    'no_clear,no_scale'),
+	Stat('cache_eviction_worker_evicting_min',
+	    'cache: pages evicted by the least busy eviction worker thread',
+	    'no_clear,no_scale'),
+	Stat('cache_eviction_workers',
+	    'cache: eviction worker threads currently running',
+	    'no_clear,no_scale'),
 	Stat('cache_inmem_split',
 	    'pages split because they were unable to be evicted'),
+	Stat('cache_leaf_hash',
+	    'cache: leaf page hash indexes built'),
 	Stat('cache_pages_dirty',
 	    'cache: tracked dirty pages in the cache', 'no_scale'),
 	Stat('cache_pages_inuse',
 	    'cache: pages currently held in the cache', 'no_clear,no_scale'),
+	Stat('cache_pages_protected',
+	    'cache: pages moved to the protected part of the cache'),
+	Stat('cache_prefetch_queued', 'cache: pages queued for prefetch'),
+	Stat('cache_prefetch_read',
+	    'cache: pages read into cache by prefetch threads'),
+	Stat('cache_prefetch_skipped',
+	    'cache: prefetch requests skipped because the queue or cache '
+	    'was full'),
+	Stat('cache_prefetch_used', 'cache: prefetched pages used'),
 	Stat('cache_read', 'cache: pages read into cache'),
+	Stat('cache_read_ahead',
+	    'cache: pages scheduled for read-ahead by cursor scans'),
 	Stat('cache_write', 'cache: pages written from cache'),
+	Stat('cache_write_behind',
+	    'cache: pages written by write-behind threads'),
 
 	##########################################
 	# Dhandle statistics
@@ -111,7 +175,17 @@ connection_stats = [
 	    'log: total log buffer size', 'no_clear,no_scale'),
 	Stat('log_bytes_user', 'log: user provided log bytes written'),
 	Stat('log_bytes_written', 'log: log bytes written'),
+	Stat('log_compress_len', 'log: total size of compressed records'),
+	Stat('log_compress_mem',
+	    'log: total in-memory size of compressed records'),
+	Stat('log_compress_small', 'log: log records too small to compress'),
+	Stat('log_compress_write_fails', 'log: log records not compressed'),
+	Stat('log_compress_writes', 'log: log records compressed'),
 	Stat('log_max_filesize', 'log: maximum log file size', 'no_clear'),
+	Stat('log_prealloc_files', 'log: pre-allocated log files prepared'),
+	Stat('log_prealloc_missed',
+	    'log: log file switches without a pre-allocated file'),
+	Stat('log_prealloc_used', 'log: pre-allocated log files used'),
 	Stat('log_reads', 'log: log read operations'),
 	Stat('log_scan_records', 'log: records processed by log scan'),
 	Stat('log_scan_rereads', 'log: log scan records requiring two reads'),
@@ -147,12 +221,24 @@ connection_stats = [
 	##########################################
 	Stat('txn_begin', 'transactions'),
 	Stat('txn_checkpoint', 'transaction checkpoints'),
+	Stat('txn_checkpoint_incremental_bytes',
+	    'transaction checkpoint dirty bytes written between checkpoints'),
+	Stat('txn_checkpoint_incremental_pages',
+	    'transaction checkpoint pages written between checkpoints'),
 	Stat('txn_checkpoint_running',
 	    'transaction checkpoint currently running',
 	    'no_aggregate,no_clear,no_scale'),
 	Stat('txn_commit', 'transactions committed'),
 	Stat('txn_fail_cache', 'transaction failures due to cache overflow'),
+	Stat('txn_recover_file',
+	    'transaction recovery log file being replayed',
+	    'no_aggregate,no_clear,no_scale'),
+	Stat('txn_recover_ops', 'transaction recovery operations applied'),
 	Stat('txn_rollback', 'transactions rolled-back'),
+	Stat('txn_snapshot_states',
+	    'transaction states examined for snapshots'),
+	Stat('txn_snapshot_time', 'transaction snapshot time (nsecs)'),
+	Stat('txn_snapshots', 'transaction snapshots'),
 
 	##########################################
 	# LSM statistics
@@ -169,6 +255,12 @@ connection_stats = [
 	##########################################
 	Stat('cursor_create', 'cursor creation'),
 	Stat('cursor_insert', 'Btree cursor insert calls'),
+	Stat('cursor_insert_append_race',
+	    'Btree cursor appends moved past a racing append'),
+	Stat('cursor_insert_finger',
+	    'Btree cursor insert list searches from the cursor finger'),
+	Stat('cursor_insert_restart',
+	    'Btree cursor inserts retried after racing an insert'),
 	Stat('cursor_next', 'Btree cursor next calls'),
 	Stat('cursor_prev', 'Btree cursor prev calls'),
 	Stat('cursor_remove', 'Btree cursor remove calls'),
@@ -303,6 +395,8 @@ dsrc_stats = [
 	Stat('cache_overflow_value',
 	    'overflow values cached in memory', 'no_scale'),
 	Stat('cache_read', 'pages read into cache'),
+	Stat('cache_read_ahead',
+	    'pages scheduled for read-ahead by cursor scans'),
 	Stat('cache_read_overflow', 'overflow pages read into cache'),
 	Stat('cache_write', 'pages written from cache'),
 
@@ -641,6 +641,22 @@ session_ops(WT_SESSION *session)
 	ret = session->truncate(session, NULL, start, stop, NULL);
 	/*! [Truncate a range] */
 	}
+
+	{
+	/*! [Prefetch a range] */
+	WT_CURSOR *start, *stop;
+
+	ret = session->open_cursor(
+	    session, "table:mytable", NULL, NULL, &start);
+	start->set_key(start, "July01");
+
+	ret = session->open_cursor(
+	    session, "table:mytable", NULL, NULL, &stop);
+	stop->set_key(stop, "July31");
+
+	ret = session->prefetch(session, NULL, start, stop, NULL);
+	/*! [Prefetch a range] */
+	}
 	}
 
 	/*! [Upgrade a table] */
@@ -985,6 +1001,28 @@ main(void)
 		(void)conn->close(conn, NULL);
 #endif
 
+	/* Might Not Run: asynchronous I/O may not be available. */
+	/*! [Configure async_io] */
+	ret = wiredtiger_open(home, NULL,
+	    "create,async_io=(enabled=true,queue_depth=64)", &conn);
+	/*! [Configure async_io] */
+	if (ret == 0)
+		(void)conn->close(conn, NULL);
+
+	/*! [Configure block_cache] */
+	ret = wiredtiger_open(home, NULL,
+	    "create,cache_size=500MB,block_cache=(size=1GB)", &conn);
+	/*! [Configure block_cache] */
+	if (ret == 0)
+		(void)conn->close(conn, NULL);
+
+	/*! [Configure buffer_pool] */
+	ret = wiredtiger_open(home, NULL,
+	    "create,direct_io=[data],buffer_pool=(size=64MB)", &conn);
+	/*! [Configure buffer_pool] */
+	if (ret == 0)
+		(void)conn->close(conn, NULL);
+
 	/*! [Configure file_extend] */
 	ret = wiredtiger_open(
 	    home, NULL, "create,file_extend=(data=16MB)", &conn);
@@ -21,6 +21,7 @@ COPYDOC(__wt_session, WT_SESSION, create)
 COPYDOC(__wt_session, WT_SESSION, compact)
 COPYDOC(__wt_session, WT_SESSION, drop)
 COPYDOC(__wt_session, WT_SESSION, log_printf)
+COPYDOC(__wt_session, WT_SESSION, prefetch)
 COPYDOC(__wt_session, WT_SESSION, rename)
 COPYDOC(__wt_session, WT_SESSION, salvage)
 COPYDOC(__wt_session, WT_SESSION, truncate)
@@ -0,0 +1,306 @@
+/*-
+ * Copyright (c) 2008-2013 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+static int __block_aio_overlap(WT_SESSION_IMPL *, WT_BLOCK *, off_t, uint32_t);
+static int __block_aio_reap(WT_SESSION_IMPL *, WT_BLOCK *, u_int);
+
+/*
+ * __wt_block_aio_open --
+ *	Configure asynchronous writes for a block handle.
+ */
+int
+__wt_block_aio_open(WT_SESSION_IMPL *session, WT_BLOCK *block)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+	u_int i;
+
+	conn = S2C(session);
+
+	if (conn->aio_depth == 0)
+		return (0);
+
+	/*
+	 * The kernel limits the number of asynchronous requests in the system,
+	 * if we can't get a context, use synchronous writes for this file.
+	 */
+	if ((ret = __wt_aio_open(session, conn->aio_depth, &block->aio)) != 0) {
+		if (ret == EAGAIN) {
+			WT_VERBOSE_RET(session, block,
+			    "%s: asynchronous I/O unavailable, writes will be "
+			    "synchronous", block->name);
+			return (0);
+		}
+		WT_RET_MSG(session, ret, "%s: io_setup", block->name);
+	}
+
+	WT_RET(__wt_spin_init(session, &block->aio_lock, "block aio"));
+	WT_RET(__wt_calloc_def(session, conn->aio_depth, &block->aio_events));
+	WT_RET(__wt_calloc_def(session, conn->aio_depth, &block->aio_slot));
+	for (i = 0; i < conn->aio_depth; ++i)
+		F_SET(&block->aio_slot[i].buf, WT_ITEM_ALIGNED);
+	return (0);
+}
+
+/*
+ * __wt_block_aio_close --
+ *	Wait for a block handle's asynchronous writes and discard the context.
+ */
+int
+__wt_block_aio_close(WT_SESSION_IMPL *session, WT_BLOCK *block)
+{
+	WT_DECL_RET;
+	u_int depth, i;
+
+	if (block->aio == NULL)
+		return (0);
+	depth = block->aio->depth;
+
+	if (block->aio_slot != NULL)
+		ret = __wt_block_aio_drain(session, block);
+	WT_TRET(__wt_aio_close(session, &block->aio));
+
+	if (block->aio_slot != NULL)
+		for (i = 0; i < depth; ++i)
+			__wt_buf_free(session, &block->aio_slot[i].buf);
+	__wt_free(session, block->aio_slot);
+	__wt_free(session, block->aio_events);
+	__wt_spin_destroy(session, &block->aio_lock);
+
+	return (ret);
+}
+
+/*
+ * __wt_block_aio_write --
+ *	Start an asynchronous write of a block.
+ */
+int
+__wt_block_aio_write(WT_SESSION_IMPL *session,
+    WT_BLOCK *block, const void *mem, off_t offset, uint32_t size)
+{
+	WT_BLOCK_AIO *slot;
+	WT_DECL_RET;
+
+	__wt_spin_lock(session, &block->aio_lock);
+
+	/*
+	 * Writes in flight aren't ordered: if there's an earlier write to the
+	 * same part of the file in flight (the block was freed and allocated
+	 * again while it was being written), wait for it to complete.
+	 */
+	WT_ERR(__block_aio_overlap(session, block, offset, size));
+
+	/*
+	 * Collect any completed writes once half of the slots are in use (so
+	 * readers don't wait for writes that have already completed), then
+	 * wait for a free slot.  The lock can be released while we wait, but
+	 * no overlapping write can start: overlapping writes are to blocks
+	 * freed before this one was allocated, they've already started.
+	 */
+	if (block->aio_pending >= block->aio->depth / 2)
+		WT_ERR(__block_aio_reap(session, block, 0));
+	while (block->aio_pending == block->aio->depth) {
+		WT_STAT_FAST_CONN_INCR(session, block_write_async_wait);
+		WT_ERR(__block_aio_reap(session, block, 1));
+	}
+	for (slot = block->aio_slot; slot->busy; ++slot)
+		;
+
+	/*
+	 * Copy the block, our caller's buffer is re-used as soon as we return.
+	 */
+	WT_ERR(__wt_buf_initsize(session, &slot->buf, size));
+	memcpy(slot->buf.mem, mem, size);
+	WT_ERR(__wt_aio_write(session, block->aio,
+	    (u_int)(slot - block->aio_slot),
+	    block->fh, offset, size, slot->buf.mem));
+
+	slot->offset = offset;
+	slot->size = size;
+	slot->busy = 1;
+	++block->aio_pending;
+	++block->aio_inflight;
+	WT_STAT_FAST_CONN_INCR(session, block_write_async);
+
+err:	__wt_spin_unlock(session, &block->aio_lock);
+	return (ret);
+}
+
+/*
+ * __wt_block_aio_wait --
+ *	Wait for any asynchronous writes to part of a file to complete.
+ */
+int
+__wt_block_aio_wait(
+    WT_SESSION_IMPL *session, WT_BLOCK *block, off_t offset, uint32_t size)
+{
+	WT_DECL_RET;
+
+	__wt_spin_lock(session, &block->aio_lock);
+	ret = __block_aio_overlap(session, block, offset, size);
+	__wt_spin_unlock(session, &block->aio_lock);
+	return (ret);
+}
+
+/*
+ * __wt_block_aio_drain --
+ *	Wait for all of a file's asynchronous writes to complete, returning any
+ * error from a write that has completed since the last drain.
+ */
+int
+__wt_block_aio_drain(WT_SESSION_IMPL *session, WT_BLOCK *block)
+{
+	WT_DECL_RET;
+
+	if (block->aio == NULL)
+		return (0);
+
+	__wt_spin_lock(session, &block->aio_lock);
+	while (block->aio_pending != 0) {
+		WT_STAT_FAST_CONN_INCR(session, block_write_async_wait);
+		WT_ERR(__block_aio_reap(session, block, 1));
+	}
+	ret = block->aio_error;
+	block->aio_error = 0;
+
+err:	__wt_spin_unlock(session, &block->aio_lock);
+	return (ret);
+}
+
+/*
+ * __block_aio_overlap --
+ *	Wait for asynchronous writes overlapping part of a file to complete,
+ * called with the asynchronous write lock held.
+ */
+static int
+__block_aio_overlap(
+    WT_SESSION_IMPL *session, WT_BLOCK *block, off_t offset, uint32_t size)
+{
+	WT_BLOCK_AIO *slot;
+	u_int i;
+
+	for (;;) {
+		for (i = 0, slot = block->aio_slot;
+		    i < block->aio->depth; ++i, ++slot)
+			if (slot->busy &&
+			    offset < slot->offset + (off_t)slot->size &&
+			    slot->offset < offset + (off_t)size)
+				break;
+		if (i == block->aio->depth)
+			return (0);
+
+		WT_STAT_FAST_CONN_INCR(session, block_write_async_wait);
+		WT_RET(__block_aio_reap(session, block, 1));
+	}
+	/* NOTREACHED */
+}
+
+/*
+ * __block_aio_error --
+ *	Report a failed asynchronous write.  Write errors can't be returned to
+ * the thread that wrote the block (the block's address may already be
+ * referenced by a parent page), save the error and fail the next file flush
+ * or checkpoint.
+ */
+static void
+__block_aio_error(WT_SESSION_IMPL *session,
+    WT_BLOCK *block, WT_BLOCK_AIO *slot, int error)
+{
+	__wt_err(session, error,
+	    "%s: asynchronous write of %" PRIu32
+	    " bytes at offset %" PRIuMAX " failed",
+	    block->name, slot->size, (uintmax_t)slot->offset);
+	if (block->aio_error == 0)
+		block->aio_error = error;
+}
+
+/*
+ * __block_aio_reap --
+ *	Collect completed asynchronous writes, waiting for at least min writes
+ * to complete, called with the asynchronous write lock held.  The lock may be
+ * released and re-acquired, callers must check their state again.
+ */
+static int
+__block_aio_reap(WT_SESSION_IMPL *session, WT_BLOCK *block, u_int min)
+{
+	WT_AIO_EVENT *ev;
+	WT_BLOCK_AIO *slot;
+	WT_DECL_RET;
+	u_int i, n;
+
+	/*
+	 * If there are no writes in flight, the writes we're waiting for are
+	 * short writes being finished by other threads; if another thread is
+	 * already waiting for writes to complete, it will collect ours.  Either
+	 * way, let the other threads run.
+	 */
+	if (block->aio_inflight == 0 || block->aio_reaping) {
+		if (min != 0) {
+			__wt_spin_unlock(session, &block->aio_lock);
+			__wt_yield();
+			__wt_spin_lock(session, &block->aio_lock);
+		}
+		return (0);
+	}
+
+	/*
+	 * Don't hold the lock while waiting for writes to complete, other
+	 * threads can start writes and check for overlapping writes.  Only one
+	 * thread at a time collects completed writes, the events array isn't
+	 * shared.
+	 */
+	block->aio_reaping = 1;
+	if (min != 0)
+		__wt_spin_unlock(session, &block->aio_lock);
+	ret = __wt_aio_reap(session, block->aio, min, block->aio_events, &n);
+	if (min != 0)
+		__wt_spin_lock(session, &block->aio_lock);
+	block->aio_reaping = 0;
+	WT_RET(ret);
+
+	for (i = 0, ev = block->aio_events; i < n; ++i, ++ev) {
+		slot = &block->aio_slot[ev->slot];
+		WT_ASSERT(session, slot->busy);
+		--block->aio_inflight;
+
+		if (ev->result >= 0 && ev->result < (int64_t)slot->size) {
+			slot->written = (uint32_t)ev->result;
+			slot->finish = 1;
+			continue;
+		}
+		if (ev->result < 0)
+			__block_aio_error(
+			    session, block, slot, (int)-ev->result);
+		slot->busy = 0;
+		--block->aio_pending;
+	}
+
+	/*
+	 * Finish short writes synchronously, without holding the lock.  The
+	 * slots stay busy until the write is done, so their buffers aren't
+	 * re-used and overlapping writes wait for them.
+	 */
+	for (i = 0, slot = block->aio_slot;
+	    i < block->aio->depth; ++i, ++slot) {
+		if (!slot->finish)
+			continue;
+		slot->finish = 0;
+		__wt_spin_unlock(session, &block->aio_lock);
+		ret = __wt_write(session, block->fh,
+		    slot->offset + (off_t)slot->written,
+		    slot->size - slot->written,
+		    (uint8_t *)slot->buf.mem + slot->written);
+		__wt_spin_lock(session, &block->aio_lock);
+		if (ret != 0)
+			__block_aio_error(session, block, slot, ret);
+		slot->busy = 0;
+		--block->aio_pending;
+	}
+	return (0);
+}
@@ -0,0 +1,298 @@
+/*-
+ * Copyright (c) 2008-2013 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+/*
+ * The number of hash buckets is based on the cache size, assuming pages of
+ * roughly 32KB, up to a maximum.
+ */
+#define	WT_BLOCK_CACHE_HASH_MAX		(64 * 1024)
+#define	WT_BLOCK_CACHE_HASH_MIN		64
+
+TAILQ_HEAD(__wt_block_cache_freeq, __wt_block_cache_entry);
+
+/*
+ * __block_cache_bucket --
+ *	Return the hash bucket for a block.
+ */
+static inline u_int
+__block_cache_bucket(WT_BLOCK_CACHE *cache, WT_BLOCK *block, off_t offset)
+{
+	return ((u_int)(((uintptr_t)block >> 4) +
+	    ((uint64_t)offset >> 9)) % cache->hash_size);
+}
+
+/*
+ * __block_cache_unlink --
+ *	Remove an entry from the cache, the caller holds the cache's lock.
+ */
+static inline void
+__block_cache_unlink(WT_BLOCK_CACHE *cache, WT_BLOCK_CACHE_ENTRY *entry)
+{
+	TAILQ_REMOVE(&cache->hash[
+	    __block_cache_bucket(cache, entry->block, entry->offset)],
+	    entry, hashq);
+	TAILQ_REMOVE(&cache->lruqh, entry, q);
+	cache->bytes_inuse -= entry->image_size;
+}
+
+/*
+ * __block_cache_free --
+ *	Free a list of entries removed from the cache.
+ */
+static void
+__block_cache_free(
+    WT_SESSION_IMPL *session, struct __wt_block_cache_freeq *freeq)
+{
+	WT_BLOCK_CACHE_ENTRY *entry;
+
+	while ((entry = TAILQ_FIRST(freeq)) != NULL) {
+		TAILQ_REMOVE(freeq, entry, q);
+		__wt_overwrite_and_free_len(
+		    session, entry->image, entry->image_size);
+		__wt_free(session, entry);
+	}
+}
+
+/*
+ * __wt_block_cache_create --
+ *	Configure and create the block cache.
+ */
+int
+__wt_block_cache_create(WT_CONNECTION_IMPL *conn, const char *cfg[])
+{
+	WT_BLOCK_CACHE *cache;
+	WT_CONFIG_ITEM cval;
+	WT_DECL_RET;
+	WT_SESSION_IMPL *session;
+	u_int i;
+
+	session = conn->default_session;
+
+	WT_RET(__wt_config_gets(session, cfg, "block_cache.size", &cval));
+	if (cval.val == 0)
+		return (0);
+
+	WT_RET(__wt_calloc_def(session, 1, &conn->block_cache));
+	cache = conn->block_cache;
+	cache->bytes_max = (uint64_t)cval.val;
+
+	WT_ERR(__wt_spin_init(session, &cache->lock, "block cache"));
+
+	cache->hash_size = (u_int)WT_MIN(
+	    cache->bytes_max / (32 * WT_KILOBYTE), WT_BLOCK_CACHE_HASH_MAX);
+	cache->hash_size = WT_MAX(cache->hash_size, WT_BLOCK_CACHE_HASH_MIN);
+	WT_ERR(__wt_calloc_def(session, cache->hash_size, &cache->hash));
+	for (i = 0; i < cache->hash_size; ++i)
+		TAILQ_INIT(&cache->hash[i]);
+	TAILQ_INIT(&cache->lruqh);
+
+	return (0);
+
+err:	WT_TRET(__wt_block_cache_destroy(conn));
+	return (ret);
+}
+
+/*
+ * __wt_block_cache_destroy --
+ *	Discard the block cache.
+ */
+int
+__wt_block_cache_destroy(WT_CONNECTION_IMPL *conn)
+{
+	WT_BLOCK_CACHE *cache;
+	WT_SESSION_IMPL *session;
+	struct __wt_block_cache_freeq freeq;
+
+	session = conn->default_session;
+	cache = conn->block_cache;
+
+	if (cache == NULL)
+		return (0);
+
+	if (cache->hash != NULL) {
+		TAILQ_INIT(&freeq);
+		TAILQ_CONCAT(&freeq, &cache->lruqh, q);
+		__block_cache_free(session, &freeq);
+	}
+
+	__wt_spin_destroy(session, &cache->lock);
+	__wt_free(session, cache->hash);
+	__wt_free(session, conn->block_cache);
+	return (0);
+}
+
+/*
+ * __wt_block_cache_get --
+ *	Look for a block's page image in the cache.  If found, the image is
+ * removed from the cache and returned in the caller's buffer.
+ */
+void
+__wt_block_cache_get(WT_SESSION_IMPL *session, WT_BLOCK *block,
+    off_t offset, uint32_t size, uint32_t cksum, WT_ITEM *buf, int *foundp)
+{
+	WT_BLOCK_CACHE *cache;
+	WT_BLOCK_CACHE_ENTRY *entry;
+	u_int bucket;
+
+	*foundp = 0;
+	cache = S2C(session)->block_cache;
+	bucket = __block_cache_bucket(cache, block, offset);
+
+	__wt_spin_lock(session, &cache->lock);
+	TAILQ_FOREACH(entry, &cache->hash[bucket], hashq)
+		if (entry->block == block && entry->offset == offset &&
+		    entry->size == size && entry->cksum == cksum) {
+			__block_cache_unlink(cache, entry);
+			WT_STAT_FAST_CONN_SET(
+			    session, block_cache_bytes, cache->bytes_inuse);
+			break;
+		}
+	__wt_spin_unlock(session, &cache->lock);
+
+	if (entry == NULL) {
+		WT_STAT_FAST_CONN_INCR(session, block_cache_miss);
+		return;
+	}
+
+	/* The buffer takes ownership of the image's memory. */
+	__wt_buf_free(session, buf);
+	buf->mem = entry->image;
+	buf->memsize = entry->image_size;
+	buf->data = buf->mem;
+	buf->size = entry->image_size;
+	__wt_free(session, entry);
+
+	*foundp = 1;
+	WT_STAT_FAST_CONN_INCR(session, block_cache_hit);
+}
+
+/*
+ * __wt_block_cache_put --
+ *	Add a block's page image to the cache, discarding the least-recently
+ * added images to make space.  The cache takes ownership of the image's
+ * memory, freeing it if the image can't be cached.
+ */
+void
+__wt_block_cache_put(WT_SESSION_IMPL *session, WT_BLOCK *block, off_t offset,
+    uint32_t size, uint32_t cksum, void *image, size_t image_size)
+{
+	WT_BLOCK_CACHE *cache;
+	WT_BLOCK_CACHE_ENTRY *entry, *old;
+	struct __wt_block_cache_freeq freeq;
+	u_int bucket;
+
+	cache = S2C(session)->block_cache;
+
+	if (image_size > cache->bytes_max ||
+	    __wt_calloc_def(session, 1, &entry) != 0) {
+		__wt_overwrite_and_free_len(session, image, image_size);
+		return;
+	}
+	entry->block = block;
+	entry->offset = offset;
+	entry->size = size;
+	entry->cksum = cksum;
+	entry->image = image;
+	entry->image_size = image_size;
+
+	TAILQ_INIT(&freeq);
+	bucket = __block_cache_bucket(cache, block, offset);
+
+	__wt_spin_lock(session, &cache->lock);
+
+	/* Replace any image of the block that's already cached. */
+	TAILQ_FOREACH(old, &cache->hash[bucket], hashq)
+		if (old->block == block && old->offset == offset) {
+			__block_cache_unlink(cache, old);
+			TAILQ_INSERT_TAIL(&freeq, old, q);
+			break;
+		}
+
+	/* Make space. */
+	while (cache->bytes_inuse + image_size > cache->bytes_max &&
+	    (old = TAILQ_FIRST(&cache->lruqh)) != NULL) {
+		__block_cache_unlink(cache, old);
+		TAILQ_INSERT_TAIL(&freeq, old, q);
+		WT_STAT_FAST_CONN_INCR(session, block_cache_evict);
+	}
+
+	TAILQ_INSERT_HEAD(&cache->hash[bucket], entry, hashq);
+	TAILQ_INSERT_TAIL(&cache->lruqh, entry, q);
+	cache->bytes_inuse += image_size;
+	WT_STAT_FAST_CONN_SET(session, block_cache_bytes, cache->bytes_inuse);
+
+	__wt_spin_unlock(session, &cache->lock);
+
+	WT_STAT_FAST_CONN_INCR(session, block_cache_insert);
+
+	/* Free any discarded images after releasing the lock. */
+	__block_cache_free(session, &freeq);
+}
+
+/*
+ * __wt_block_cache_remove --
+ *	Discard any cached image of a block that's being freed.
+ */
+void
+__wt_block_cache_remove(
+    WT_SESSION_IMPL *session, WT_BLOCK *block, off_t offset)
+{
+	WT_BLOCK_CACHE *cache;
+	WT_BLOCK_CACHE_ENTRY *entry;
+	struct __wt_block_cache_freeq freeq;
+	u_int bucket;
+
+	cache = S2C(session)->block_cache;
+
+	TAILQ_INIT(&freeq);
+	bucket = __block_cache_bucket(cache, block, offset);
+
+	__wt_spin_lock(session, &cache->lock);
+	TAILQ_FOREACH(entry, &cache->hash[bucket], hashq)
+		if (entry->block == block && entry->offset == offset) {
+			__block_cache_unlink(cache, entry);
+			TAILQ_INSERT_TAIL(&freeq, entry, q);
+			WT_STAT_FAST_CONN_SET(
+			    session, block_cache_bytes, cache->bytes_inuse);
+			break;
+		}
+	__wt_spin_unlock(session, &cache->lock);
+
+	__block_cache_free(session, &freeq);
+}
+
+/*
+ * __wt_block_cache_discard --
+ *	Discard all of a block handle's cached images, the handle is being
+ * destroyed.
+ */
+void
+__wt_block_cache_discard(WT_SESSION_IMPL *session, WT_BLOCK *block)
+{
+	WT_BLOCK_CACHE *cache;
+	WT_BLOCK_CACHE_ENTRY *entry, *next;
+	struct __wt_block_cache_freeq freeq;
+
+	cache = S2C(session)->block_cache;
+
+	TAILQ_INIT(&freeq);
+
+	__wt_spin_lock(session, &cache->lock);
+	for (entry = TAILQ_FIRST(&cache->lruqh); entry != NULL; entry = next) {
+		next = TAILQ_NEXT(entry, q);
+		if (entry->block == block) {
+			__block_cache_unlink(cache, entry);
+			TAILQ_INSERT_TAIL(&freeq, entry, q);
+		}
+	}
+	WT_STAT_FAST_CONN_SET(session, block_cache_bytes, cache->bytes_inuse);
+	__wt_spin_unlock(session, &cache->lock);
+
+	__block_cache_free(session, &freeq);
+}
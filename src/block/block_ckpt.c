@@ -166,12 +166,20 @@ __wt_block_checkpoint_unload(
 		WT_TRET(__wt_verify_ckpt_unload(session, block));
 
 	/* If it's the live system, truncate to discard any extended blocks. */
-	if (!checkpoint)
+	if (!checkpoint) {
+		WT_TRET(__wt_block_aio_drain(session, block));
 		WT_TRET(__wt_ftruncate(session, block->fh, block->fh->size));
+	}
 
 	/* If it's the live system, discard the active extent lists. */
-	if (!checkpoint)
+	if (!checkpoint) {
+		__wt_block_arena_lock(session, block);
+		__wt_spin_lock(session, &block->live_lock);
+		WT_TRET(__wt_block_arena_discard(session, block));
+		__wt_spin_unlock(session, &block->live_lock);
+		__wt_block_arena_unlock(session, block);
 		__wt_block_ckpt_destroy(session, &block->live);
+	}
 
 	return (ret);
 }
@@ -230,6 +238,13 @@ __wt_block_checkpoint(WT_SESSION_IMPL *session,
 	/* Process the checkpoint list, deleting and updating as required. */
 	ret = __ckpt_process(session, block, ckptbase);
 
+	/*
+	 * Wait for any asynchronous writes: our caller is about to reference
+	 * the checkpoint from the metadata, and the checkpoint fails if any
+	 * of its blocks couldn't be written.
+	 */
+	WT_TRET(__wt_block_aio_drain(session, block));
+
 	/* Discard any excessive memory we've allocated. */
 	WT_TRET(__wt_block_ext_discard(session, 250));
 
@@ -412,9 +427,16 @@ __ckpt_process(
 	 * information without a lock, but we could also merge and re-write the
 	 * deleted and merged checkpoint information without a lock, except for
 	 * the final merge of ranges into the live tree.
+	 *
+	 * Lock the allocation arenas as well: the root page was the last block
+	 * written into the checkpoint, return the unused space the arenas
+	 * reserved to the avail list, and don't let threads reserve more until
+	 * the checkpoint's extent lists are complete.
 	 */
+	__wt_block_arena_lock(session, block);
 	__wt_spin_lock(session, &block->live_lock);
 	locked = 1;
+	WT_ERR(__wt_block_arena_discard(session, block));
 
 	/* Skip the additional processing if we aren't deleting checkpoints. */
 	if (!deleting)
@@ -587,8 +609,10 @@ live_update:
 #endif
 	block->ckpt_inprogress = 1;
 
-err:	if (locked)
+err:	if (locked) {
 		__wt_spin_unlock(session, &block->live_lock);
+		__wt_block_arena_unlock(session, block);
+	}
 
 	/* Discard any checkpoint information we loaded. */
 	WT_CKPT_FOREACH(ckptbase, ckpt)
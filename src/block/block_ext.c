@@ -524,6 +524,131 @@ done:	/* Add the newly allocated extent to the list of allocations. */
 	return (0);
 }
 
+/*
+ * __wt_block_alloc_arena --
+ *	Alloc a chunk of space from the underlying file, using the session's
+ * allocation arena.
+ */
+int
+__wt_block_alloc_arena(
+    WT_SESSION_IMPL *session, WT_BLOCK *block, off_t *offp, off_t size)
+{
+	WT_BLOCK_ARENA *arena;
+	WT_DECL_RET;
+	WT_SIZE **sstack[WT_SKIP_MAXDEPTH];
+	off_t chunk;
+
+	WT_RET(__wt_block_ext_prealloc(session, 10));
+
+	/*
+	 * Large blocks go directly to the avail list, as does first-fit
+	 * allocation: compaction uses it to move blocks toward the start of
+	 * the file, and arenas would hide the lowest available offsets.
+	 */
+	chunk = (off_t)WT_ALIGN(WT_BLOCK_ARENA_SIZE, block->allocsize);
+	if (block->allocfirst || size > chunk / 4) {
+		__wt_spin_lock(session, &block->live_lock);
+		ret = __wt_block_alloc(session, block, offp, size);
+		__wt_spin_unlock(session, &block->live_lock);
+		return (ret);
+	}
+
+	arena = &block->arena[session->id % WT_BLOCK_ARENAS];
+	__wt_spin_lock(session, &arena->lock);
+	if (arena->size < size) {
+		__wt_spin_lock(session, &block->live_lock);
+
+		/* Return what's left of the arena's range. */
+		if (arena->size != 0) {
+			ret = __wt_block_off_free(
+			    session, block, arena->off, arena->size);
+			arena->size = 0;
+		}
+
+		/*
+		 * Reserve a new range if the avail list has one large enough,
+		 * or if the file is being extended regardless.  Otherwise the
+		 * avail list is fragmented: allocate just this block, so the
+		 * small ranges are re-used.
+		 */
+		if (ret == 0) {
+			__block_size_srch(block->live.avail.sz, chunk, sstack);
+			if (*sstack[0] == NULL) {
+				__block_size_srch(
+				    block->live.avail.sz, size, sstack);
+				if (*sstack[0] != NULL) {
+					ret = __wt_block_alloc(
+					    session, block, offp, size);
+					__wt_spin_unlock(
+					    session, &block->live_lock);
+					goto err;
+				}
+			}
+			if ((ret = __wt_block_alloc(
+			    session, block, &arena->off, chunk)) == 0)
+				arena->size = chunk;
+		}
+		__wt_spin_unlock(session, &block->live_lock);
+		WT_ERR(ret);
+	}
+
+	WT_STAT_FAST_DATA_INCR(session, block_alloc);
+	*offp = arena->off;
+	arena->off += size;
+	arena->size -= size;
+
+err:	__wt_spin_unlock(session, &arena->lock);
+	return (ret);
+}
+
+/*
+ * __wt_block_arena_lock --
+ *	Lock the allocation arenas, holding out threads allocating from them.
+ * The arena locks are acquired before the live lock.
+ */
+void
+__wt_block_arena_lock(WT_SESSION_IMPL *session, WT_BLOCK *block)
+{
+	u_int i;
+
+	for (i = 0; i < WT_BLOCK_ARENAS; ++i)
+		__wt_spin_lock(session, &block->arena[i].lock);
+}
+
+/*
+ * __wt_block_arena_unlock --
+ *	Unlock the allocation arenas.
+ */
+void
+__wt_block_arena_unlock(WT_SESSION_IMPL *session, WT_BLOCK *block)
+{
+	u_int i;
+
+	for (i = 0; i < WT_BLOCK_ARENAS; ++i)
+		__wt_spin_unlock(session, &block->arena[i].lock);
+}
+
+/*
+ * __wt_block_arena_discard --
+ *	Return the unused part of the allocation arenas' ranges to the avail
+ * list, called with the arenas and the live extent lists locked.
+ */
+int
+__wt_block_arena_discard(WT_SESSION_IMPL *session, WT_BLOCK *block)
+{
+	WT_BLOCK_ARENA *arena;
+	WT_DECL_RET;
+	u_int i;
+
+	for (i = 0, arena = block->arena; i < WT_BLOCK_ARENAS; ++i, ++arena) {
+		if (arena->size != 0)
+			WT_TRET(__wt_block_off_free(
+			    session, block, arena->off, arena->size));
+		arena->size = 0;
+	}
+	return (ret);
+}
+
 /*
  * __wt_block_free --
  *	Free a cookie-referenced chunk of space to the underlying file.
@@ -545,6 +670,10 @@ __wt_block_free(WT_SESSION_IMPL *session,
 	WT_VERBOSE_RET(session, block,
 	    "free %" PRIdMAX "/%" PRIdMAX, (intmax_t)offset, (intmax_t)size);
 
+	/* Discard any cached image of the block. */
+	if (S2C(session)->block_cache != NULL)
+		__wt_block_cache_remove(session, block, offset);
+
 #ifdef HAVE_DIAGNOSTIC
 	WT_RET(__wt_block_misplaced(session, block, "free", offset, size, 1));
 #endif
@@ -1193,6 +1322,7 @@ __wt_block_extlist_truncate(
 	 * truncate and extent list removal succeed.
 	 */
 	size = ext->off;
+	WT_RET(__wt_block_aio_drain(session, block));
 	WT_RET(__wt_ftruncate(session, fh, size));
 	WT_RET(__block_off_remove(session, el, size, NULL));
 	fh->size = size;
@@ -45,11 +45,132 @@ __wt_block_map(
 	 * Map the file into memory.
 	 * Ignore errors, we'll read the file through the cache if map fails.
 	 */
-	(void)__wt_mmap(session, block->fh, mapp, maplenp);
+	if (__wt_mmap(session, block->fh, (size_t)block->fh->size, mapp) == 0)
+		*maplenp = (size_t)block->fh->size;
 
 	return (0);
 }
 
+/*
+ * __wt_block_map_open --
+ *	Configure reading the live file through a memory map.
+ */
+int
+__wt_block_map_open(WT_SESSION_IMPL *session, WT_BLOCK *block)
+{
+	/*
+	 * The same restrictions apply as for mapping checkpoints, except for
+	 * verify: blocks copied from the map are checksummed like blocks read
+	 * from the file.  The file is mapped by the first read.
+	 */
+	if (!S2C(session)->mmap ||
+	    block->fh->direct_io || block->os_cache_max != 0)
+		return (0);
+
+	return (__wt_rwlock_alloc(session, "block map", &block->map_lock));
+}
+
+/*
+ * __wt_block_map_close --
+ *	Discard the live file's memory map.
+ */
+int
+__wt_block_map_close(WT_SESSION_IMPL *session, WT_BLOCK *block)
+{
+	WT_DECL_RET;
+
+	if (block->map != NULL)
+		WT_TRET(__wt_munmap(
+		    session, block->fh, block->map, block->maplen));
+	block->map = NULL;
+	block->maplen = 0;
+
+	if (block->map_lock != NULL)
+		WT_TRET(__wt_rwlock_destroy(session, &block->map_lock));
+	return (ret);
+}
+
+/*
+ * __block_remap --
+ *	Extend the live file's memory map to cover a block.
+ */
+static int
+__block_remap(WT_SESSION_IMPL *session, WT_BLOCK *block, off_t end)
+{
+	WT_DECL_RET;
+	size_t len;
+	void *map;
+
+	WT_RET(__wt_writelock(session, block->map_lock));
+
+	/* Another thread may have extended the map, or mapping failed. */
+	if (block->map_failed || end <= (off_t)block->maplen ||
+	    end > block->fh->size)
+		goto err;
+
+	/*
+	 * Map past the end of the file, so the map doesn't have to be replaced
+	 * every time the file grows.  Mapping is only address space, pages
+	 * past the end of the file are never touched.
+	 */
+	len = (size_t)block->fh->size +
+	    WT_MAX((size_t)block->fh->size / 4, WT_BLOCK_MAP_GROW);
+	if ((ret = __wt_mmap(session, block->fh, len, &map)) != 0) {
+		/* Read the file through the cache from now on. */
+		block->map_failed = 1;
+		ret = 0;
+		goto err;
+	}
+	if (block->map != NULL)
+		WT_TRET(__wt_munmap(
+		    session, block->fh, block->map, block->maplen));
+	block->map = map;
+	block->maplen = len;
+	WT_STAT_FAST_CONN_INCR(session, block_remap);
+
+err:	WT_TRET(__wt_rwunlock(session, block->map_lock));
+	return (ret);
+}
+
+/*
+ * __wt_block_map_read --
+ *	Copy a block from the live file's memory map, if it's mapped.
+ *
+ * Blocks of the live file are copied rather than referenced in place: once a
+ * block is freed it can be re-allocated and overwritten while pages read from
+ * it are still in memory.
+ */
+int
+__wt_block_map_read(WT_SESSION_IMPL *session,
+    WT_BLOCK *block, void *buf, off_t offset, uint32_t size, int *mappedp)
+{
+	WT_DECL_RET;
+	off_t end;
+
+	*mappedp = 0;
+	if (block->map_lock == NULL || block->map_failed)
+		return (0);
+
+	/*
+	 * Touching a map past the end of the file faults, leave reads of
+	 * blocks that aren't in the file (for example, salvage reading a
+	 * corrupted size) to the underlying read call.
+	 */
+	end = offset + (off_t)size;
+	if (end > block->fh->size)
+		return (0);
+	if (end > (off_t)block->maplen)
+		WT_RET(__block_remap(session, block, end));
+
+	WT_RET(__wt_readlock(session, block->map_lock));
+	if (block->map != NULL && end <= (off_t)block->maplen) {
+		memcpy(buf, (uint8_t *)block->map + offset, size);
+		*mappedp = 1;
+	}
+	WT_TRET(__wt_rwunlock(session, block->map_lock));
+	return (ret);
+}
+
 /*
  * __wt_block_unmap --
  *	Unmap any mapped-in segment of the file.
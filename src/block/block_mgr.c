@@ -73,6 +73,7 @@ __bm_checkpoint(WT_BM *bm,
 static int
 __bm_sync(WT_BM *bm, WT_SESSION_IMPL *session)
 {
+	WT_RET(__wt_block_aio_drain(session, bm->block));
 	return (__wt_fsync(session, bm->block->fh));
 }
 
@@ -205,6 +206,55 @@ __bm_compact_end(WT_BM *bm, WT_SESSION_IMPL *session)
 	return (__wt_block_compact_end(session, bm->block));
 }
 
+/*
+ * __bm_cache_get --
+ *	Take an address cookie referenced page image from the block cache.
+ */
+static int
+__bm_cache_get(WT_BM *bm, WT_SESSION_IMPL *session,
+    WT_ITEM *buf, const uint8_t *addr, uint32_t addr_size, int *foundp)
+{
+	off_t offset;
+	uint32_t cksum, size;
+
+	WT_UNUSED(addr_size);
+
+	*foundp = 0;
+	if (S2C(session)->block_cache == NULL)
+		return (0);
+
+	WT_RET(__wt_block_buffer_to_addr(
+	    bm->block, addr, &offset, &size, &cksum));
+	__wt_block_cache_get(
+	    session, bm->block, offset, size, cksum, buf, foundp);
+	return (0);
+}
+
+/*
+ * __bm_cache_put --
+ *	Give an address cookie referenced page image to the block cache.
+ */
+static int
+__bm_cache_put(WT_BM *bm, WT_SESSION_IMPL *session,
+    void *image, size_t image_size, const uint8_t *addr, uint32_t addr_size)
+{
+	WT_DECL_RET;
+	off_t offset;
+	uint32_t cksum, size;
+
+	WT_UNUSED(addr_size);
+
+	if (S2C(session)->block_cache == NULL ||
+	    (ret = __wt_block_buffer_to_addr(
+	    bm->block, addr, &offset, &size, &cksum)) != 0) {
+		__wt_overwrite_and_free_len(session, image, image_size);
+		return (ret);
+	}
+	__wt_block_cache_put(
+	    session, bm->block, offset, size, cksum, image, image_size);
+	return (0);
+}
+
 /*
  * __bm_free --
  *	Free a block of space to the underlying file.
@@ -334,6 +384,8 @@ __bm_method_set(WT_BM *bm, int readonly)
 		bm->addr_string = __bm_addr_string;
 		bm->addr_valid = __bm_addr_valid;
 		bm->block_header = __bm_block_header;
+		bm->cache_get = __bm_cache_get;
+		bm->cache_put = __bm_cache_put;
 		bm->checkpoint = (int (*)(WT_BM *,
 		    WT_SESSION_IMPL *, WT_ITEM *, WT_CKPT *, int))__bm_readonly;
 		bm->checkpoint_load = __bm_checkpoint_load;
@@ -374,6 +426,8 @@ __bm_method_set(WT_BM *bm, int readonly)
 		bm->addr_string = __bm_addr_string;
 		bm->addr_valid = __bm_addr_valid;
 		bm->block_header = __bm_block_header;
+		bm->cache_get = __bm_cache_get;
+		bm->cache_put = __bm_cache_put;
 		bm->checkpoint = __bm_checkpoint;
 		bm->checkpoint_load = __bm_checkpoint_load;
 		bm->checkpoint_resolve = __bm_checkpoint_resolve;
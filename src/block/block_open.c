@@ -71,17 +71,28 @@ __block_destroy(WT_SESSION_IMPL *session, WT_BLOCK *block)
 {
 	WT_CONNECTION_IMPL *conn;
 	WT_DECL_RET;
+	u_int i;
 
 	conn = S2C(session);
 	TAILQ_REMOVE(&conn->blockqh, block, q);
 
-	if (block->name != NULL)
-		__wt_free(session, block->name);
+	WT_TRET(__wt_block_aio_close(session, block));
+	WT_TRET(__wt_block_map_close(session, block));
+
+	/* Discard the block's cached page images. */
+	if (conn->block_cache != NULL)
+		__wt_block_cache_discard(session, block);
 
 	if (block->fh != NULL)
 		WT_TRET(__wt_close(session, block->fh));
 
 	__wt_spin_destroy(session, &block->live_lock);
+	for (i = 0; i < WT_BLOCK_ARENAS; ++i)
+		__wt_spin_destroy(session, &block->arena[i].lock);
+
+	/* Error messages from the teardown above reference the name. */
+	if (block->name != NULL)
+		__wt_free(session, block->name);
 
 	__wt_overwrite_and_free(session, block);
 
@@ -101,6 +112,7 @@ __wt_block_open(WT_SESSION_IMPL *session,
 	WT_CONFIG_ITEM cval;
 	WT_CONNECTION_IMPL *conn;
 	WT_DECL_RET;
+	u_int i;
 
 	WT_VERBOSE_TRET(session, block, "open: %s", filename);
 
@@ -161,8 +173,17 @@ __wt_block_open(WT_SESSION_IMPL *session,
 	WT_ERR(__wt_open(
 	    session, filename, 0, 0, WT_FILE_TYPE_DATA, &block->fh));
 
-	/* Initialize the live checkpoint's lock. */
+	/* Initialize the live checkpoint's and allocation arenas' locks. */
 	WT_ERR(__wt_spin_init(session, &block->live_lock, "block manager"));
+	for (i = 0; i < WT_BLOCK_ARENAS; ++i)
+		WT_ERR(__wt_spin_init(
+		    session, &block->arena[i].lock, "block arena"));
+
+	/* Configure asynchronous writes. */
+	WT_ERR(__wt_block_aio_open(session, block));
+
+	/* Configure reading through a memory map. */
+	WT_ERR(__wt_block_map_open(session, block));
 
 	/*
 	 * Read the description information from the first block.
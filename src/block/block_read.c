@@ -146,6 +146,7 @@ __wt_block_read_off(WT_SESSION_IMPL *session,
 {
 	WT_BLOCK_HEADER *blk;
 	uint32_t alloc_size, page_cksum;
+	int mapped;
 
 	WT_VERBOSE_RET(session, read,
 	    "off %" PRIuMAX ", size %" PRIu32 ", cksum %" PRIu32,
@@ -167,7 +168,16 @@ __wt_block_read_off(WT_SESSION_IMPL *session,
 		alloc_size = (uint32_t)WT_MAX(size, buf->memsize + 10);
 	}
 	WT_RET(__wt_buf_init(session, buf, alloc_size));
-	WT_RET(__wt_read(session, block->fh, offset, size, buf->mem));
+
+	/* Wait for any asynchronous write of the block to complete. */
+	if (block->aio_pending != 0)
+		WT_RET(__wt_block_aio_wait(session, block, offset, size));
+
+	/* Copy the block from the file's memory map, or read it. */
+	WT_RET(__wt_block_map_read(
+	    session, block, buf->mem, offset, size, &mapped));
+	if (!mapped)
+		WT_RET(__wt_read(session, block->fh, offset, size, buf->mem));
 	buf->size = size;
 
 	blk = WT_BLOCK_HEADER_REF(buf->mem);
@@ -184,7 +194,12 @@ __wt_block_read_off(WT_SESSION_IMPL *session,
 		return (WT_ERROR);
 	}
 
-	WT_STAT_FAST_CONN_INCR(session, block_read);
-	WT_STAT_FAST_CONN_INCRV(session, block_byte_read, size);
+	if (mapped) {
+		WT_STAT_FAST_CONN_INCR(session, block_map_read);
+		WT_STAT_FAST_CONN_INCRV(session, block_byte_map_read, size);
+	} else {
+		WT_STAT_FAST_CONN_INCR(session, block_read);
+		WT_STAT_FAST_CONN_INCRV(session, block_byte_read, size);
+	}
 	return (0);
 }
@@ -19,6 +19,9 @@ __wt_block_salvage_start(WT_SESSION_IMPL *session, WT_BLOCK *block)
 
 	allocsize = block->allocsize;
 
+	/* Salvage reads the file directly, wait for any writes. */
+	WT_RET(__wt_block_aio_drain(session, block));
+
 	/* Reset the description information in the first block. */
 	WT_RET(__wt_desc_init(session, block->fh, allocsize));
 
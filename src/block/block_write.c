@@ -33,6 +33,51 @@ __wt_block_write_size(WT_SESSION_IMPL *session, WT_BLOCK *block, size_t *sizep)
 	return (0);
 }
 
+/*
+ * __block_ckpt_throttle --
+ *	Limit the rate at which checkpoints write, using a token bucket that
+ * fills at the configured rate and holds at most a second's worth of writes.
+ */
+static int
+__block_ckpt_throttle(WT_SESSION_IMPL *session, uint32_t size)
+{
+	struct timespec now;
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+	int64_t avail, rate;
+	uint64_t usecs;
+
+	conn = S2C(session);
+	rate = (int64_t)conn->ckpt_throttle_rate;
+
+	/*
+	 * Refill the bucket for the time since the last write, then take our
+	 * bytes out of it.  The bucket can go negative: threads writing when
+	 * it's empty wait until their bytes would have been available, and
+	 * later threads wait behind them.
+	 */
+	__wt_spin_lock(session, &conn->ckpt_throttle_lock);
+	WT_ERR(__wt_epoch(session, &now));
+	usecs = WT_TIMEDIFF(now, conn->ckpt_throttle_last) / 1000;
+	conn->ckpt_throttle_last = now;
+	avail = conn->ckpt_throttle_avail +
+	    (int64_t)WT_MIN(usecs, WT_MILLION) * rate / WT_MILLION;
+	avail = WT_MIN(avail, rate) - (int64_t)size;
+	conn->ckpt_throttle_avail = avail;
+err:	__wt_spin_unlock(session, &conn->ckpt_throttle_lock);
+	WT_RET(ret);
+
+	if (avail < 0) {
+		usecs = (uint64_t)-avail * WT_MILLION / (uint64_t)rate;
+		WT_STAT_FAST_CONN_INCR(session, block_ckpt_throttle);
+		WT_STAT_FAST_CONN_INCRV(
+		    session, block_ckpt_throttle_time, usecs);
+		__wt_sleep(
+		    (long)(usecs / WT_MILLION), (long)(usecs % WT_MILLION));
+	}
+	return (0);
+}
+
 /*
  * __wt_block_write --
  *	Write a buffer into a block, returning the block's address cookie.
@@ -126,14 +171,26 @@ __wt_block_write_off(WT_SESSION_IMPL *session, WT_BLOCK *block,
 	blk->cksum = __wt_cksum(
 	    buf->mem, data_cksum ? align_size : WT_BLOCK_COMPRESS_SKIP);
 
-	if (!locked) {
-		WT_RET(__wt_block_ext_prealloc(session, 5));
-		__wt_spin_lock(session, &block->live_lock);
-	}
-	ret = __wt_block_alloc(session, block, &offset, (off_t)align_size);
-	if (!locked)
-		__wt_spin_unlock(session, &block->live_lock);
-	WT_RET(ret);
+	/*
+	 * Optionally throttle checkpoint writes.  Don't wait while holding the
+	 * live checkpoint's lock, other threads writing the file need it, and
+	 * the extent lists written under it are small.
+	 */
+	if (!locked && S2C(session)->ckpt_throttle_rate != 0 &&
+	    F_ISSET(session, WT_SESSION_CHECKPOINT))
+		WT_RET(__block_ckpt_throttle(session, align_size));
+
+	/*
+	 * Callers holding the live checkpoint's lock (checkpoints writing the
+	 * extent lists) allocate from the avail list, everyone else uses the
+	 * allocation arenas.
+	 */
+	if (locked)
+		WT_RET(__wt_block_alloc(
+		    session, block, &offset, (off_t)align_size));
+	else
+		WT_RET(__wt_block_alloc_arena(
+		    session, block, &offset, (off_t)align_size));
 
 #if defined(HAVE_POSIX_FALLOCATE) || defined(HAVE_FTRUNCATE)
 	/*
@@ -154,8 +211,12 @@ __wt_block_write_off(WT_SESSION_IMPL *session, WT_BLOCK *block,
 		WT_RET(__wt_fallocate(session, fh, offset, fh->extend_len * 2));
 	}
 #endif
-	if ((ret =
-	    __wt_write(session, fh, offset, align_size, buf->mem)) != 0) {
+	if (block->aio != NULL)
+		ret = __wt_block_aio_write(
+		    session, block, buf->mem, offset, align_size);
+	else
+		ret = __wt_write(session, fh, offset, align_size, buf->mem);
+	if (ret != 0) {
 		if (!locked)
 			__wt_spin_lock(session, &block->live_lock);
 		WT_TRET(
@@ -0,0 +1,345 @@
+/*-
+ * Copyright (c) 2008-2013 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+/*
+ * __arena_chunk_alloc --
+ *	Allocate a chunk of arena memory.
+ */
+static int
+__arena_chunk_alloc(WT_SESSION_IMPL *session,
+    WT_PAGE *page, size_t size, WT_PAGE_ARENA_CHUNK **chunkp)
+{
+	WT_PAGE_ARENA_CHUNK *chunk;
+
+	WT_RET(__wt_calloc(session,
+	    1, WT_ALIGN(sizeof(WT_PAGE_ARENA_CHUNK), 8) + size, &chunk));
+	chunk->ref = 1;
+	chunk->size = WT_STORE_SIZE(size);
+
+	/*
+	 * The page is charged for the whole chunk, not the structures allocated
+	 * from it: neither unused space at the end of the chunk nor structures
+	 * released to the arena are returned to the heap before the page is
+	 * discarded.
+	 */
+	__wt_cache_page_inmem_incr(session,
+	    page, WT_ALIGN(sizeof(WT_PAGE_ARENA_CHUNK), 8) + size);
+
+	WT_STAT_FAST_CONN_INCR(session, cache_arena_chunk);
+
+	*chunkp = chunk;
+	return (0);
+}
+
+/*
+ * __arena_chunk_release --
+ *	Release a page's reference to a chunk, freeing it if it was the last.
+ */
+static void
+__arena_chunk_release(WT_SESSION_IMPL *session, WT_PAGE_ARENA_CHUNK *chunk)
+{
+	if (WT_ATOMIC_SUB(chunk->ref, 1) == 0)
+		__wt_free(session, chunk);
+}
+
+/*
+ * __arena_large_alloc --
+ *	Allocate a structure too large for the page's free lists from the heap.
+ */
+static int
+__arena_large_alloc(WT_SESSION_IMPL *session,
+    WT_PAGE *page, WT_PAGE_ARENA *arena, size_t size, void *retp)
+{
+	WT_PAGE_ARENA_LARGE *large;
+
+	WT_RET(__wt_calloc(session,
+	    1, WT_ALIGN(sizeof(WT_PAGE_ARENA_LARGE), 8) + size, &large));
+	large->size = WT_ALIGN(sizeof(WT_PAGE_ARENA_LARGE), 8) + size;
+
+	WT_PAGE_LOCK(session, page);
+	if ((large->next = arena->large) != NULL)
+		large->next->prev = large;
+	arena->large = large;
+	WT_PAGE_UNLOCK(session, page);
+
+	__wt_cache_page_inmem_incr(session, page, large->size);
+
+	*(void **)retp = WT_PAGE_ARENA_LARGE_DATA(large);
+	return (0);
+}
+
+/*
+ * __arena_large_unlink --
+ *	Remove a heap-allocated structure from a page's list, the caller holds
+ * the page's lock.
+ */
+static void
+__arena_large_unlink(WT_PAGE_ARENA *arena, WT_PAGE_ARENA_LARGE *large)
+{
+	if (large->next != NULL)
+		large->next->prev = large->prev;
+	if (large->prev != NULL)
+		large->prev->next = large->next;
+	else
+		arena->large = large->next;
+	large->next = large->prev = NULL;
+}
+
+/*
+ * __arena_init --
+ *	Return a page's arena, allocating it the first time it's needed.
+ */
+static int
+__arena_init(WT_SESSION_IMPL *session, WT_PAGE *page, WT_PAGE_ARENA **arenap)
+{
+	WT_PAGE_ARENA *arena;
+
+	if ((arena = page->modify->arena) == NULL) {
+		WT_RET(__wt_calloc_def(session, 1, &arena));
+		arena->chunk_size = WT_PAGE_ARENA_CHUNK_MIN;
+		if (WT_ATOMIC_CAS(page->modify->arena, NULL, arena))
+			__wt_cache_page_inmem_incr(
+			    session, page, sizeof(WT_PAGE_ARENA));
+		else {
+			__wt_free(session, arena);
+			arena = page->modify->arena;
+		}
+	}
+	*arenap = arena;
+	return (0);
+}
+
+/*
+ * __wt_page_arena_alloc --
+ *	Allocate cleared memory for a structure being added to a page.
+ */
+int
+__wt_page_arena_alloc(
+    WT_SESSION_IMPL *session, WT_PAGE *page, size_t size, void *retp)
+{
+	WT_DECL_RET;
+	WT_PAGE_ARENA *arena;
+	WT_PAGE_ARENA_CHUNK *chunk, *new;
+	uint32_t off;
+	u_int class;
+	void *p;
+
+	*(void **)retp = NULL;
+
+	WT_RET(__arena_init(session, page, &arena));
+
+	/*
+	 * Structures are 8B aligned.  Structures larger than the free list size
+	 * classes come from the heap: they couldn't be reused once released.
+	 * Otherwise, check for a free structure of the same size class before
+	 * taking the page's lock.
+	 */
+	size = WT_ALIGN(size, 8);
+	class = (u_int)(size / 8) - 1;
+	if (class >= WT_PAGE_ARENA_FREE_CLASSES)
+		return (__arena_large_alloc(session, page, arena, size, retp));
+	if (arena->freeq[class] != NULL) {
+		WT_PAGE_LOCK(session, page);
+		if ((p = arena->freeq[class]) != NULL)
+			arena->freeq[class] = *(void **)p;
+		WT_PAGE_UNLOCK(session, page);
+		if (p != NULL) {
+			memset(p, 0, size);
+			WT_STAT_FAST_CONN_INCR(session, cache_arena_reuse);
+			*(void **)retp = p;
+			return (0);
+		}
+	}
+
+	for (;;) {
+		/*
+		 * Threads allocate from the current chunk without locking by
+		 * bumping its offset: if the result is past the end of the
+		 * chunk, the chunk is full.
+		 */
+		if ((chunk = arena->chunk) != NULL &&
+		    (off = WT_ATOMIC_ADD(
+		    chunk->off, (uint32_t)size)) <= chunk->size) {
+			*(void **)retp =
+			    WT_PAGE_ARENA_CHUNK_DATA(chunk) + off - size;
+			return (0);
+		}
+
+		/*
+		 * Add a new chunk, unless another thread did while we waited
+		 * for the lock.  Chunks double in size up to a maximum, pages
+		 * that are rarely modified don't tie up much memory.
+		 */
+		WT_PAGE_LOCK(session, page);
+		if (arena->chunk == chunk &&
+		    (ret = __arena_chunk_alloc(
+		    session, page, arena->chunk_size, &new)) == 0) {
+			new->next = chunk;
+			WT_PUBLISH(arena->chunk, new);
+			arena->chunk_size = WT_MIN(
+			    arena->chunk_size * 2, WT_PAGE_ARENA_CHUNK_MAX);
+		}
+		WT_PAGE_UNLOCK(session, page);
+		WT_RET(ret);
+	}
+	/* NOTREACHED */
+}
+
+/*
+ * __wt_page_arena_free --
+ *	Release a structure allocated from a page's arena and no longer in use.
+ */
+void
+__wt_page_arena_free(
+    WT_SESSION_IMPL *session, WT_PAGE *page, void *p, size_t size)
+{
+	WT_PAGE_ARENA *arena;
+	WT_PAGE_ARENA_LARGE *large;
+	u_int class;
+
+	if (p == NULL)
+		return;
+
+	/*
+	 * Structures larger than the free list size classes were allocated from
+	 * the heap: free them and remove them from the page's footprint.  Small
+	 * structures go on the page's free lists for reuse, and their memory
+	 * stays in the page's footprint.
+	 */
+	size = WT_ALIGN(size, 8);
+	if (size == 0)
+		return;
+	arena = page->modify->arena;
+	if ((class = (u_int)(size / 8) - 1) >= WT_PAGE_ARENA_FREE_CLASSES) {
+		large = (WT_PAGE_ARENA_LARGE *)
+		    ((uint8_t *)p - WT_ALIGN(sizeof(WT_PAGE_ARENA_LARGE), 8));
+		WT_PAGE_LOCK(session, page);
+		__arena_large_unlink(arena, large);
+		WT_PAGE_UNLOCK(session, page);
+		__wt_cache_page_inmem_decr(session, page, large->size);
+		__wt_free(session, large);
+		return;
+	}
+
+	WT_PAGE_LOCK(session, page);
+	*(void **)p = arena->freeq[class];
+	arena->freeq[class] = p;
+	WT_PAGE_UNLOCK(session, page);
+}
+
+/*
+ * __wt_page_arena_share --
+ *	A structure allocated from one page's arena is moving to another page:
+ * have the second page reference the chunk holding the structure so it isn't
+ * freed when the first page is discarded.  Heap-allocated structures move to
+ * the second page's list.
+ */
+int
+__wt_page_arena_share(
+    WT_SESSION_IMPL *session, WT_PAGE *from, WT_PAGE *to, void *p)
+{
+	WT_PAGE_ARENA *arena, *to_arena;
+	WT_PAGE_ARENA_CHUNK *chunk;
+	WT_PAGE_ARENA_LARGE *large;
+	WT_PAGE_ARENA_REF *ref;
+	uint8_t *addr;
+
+	addr = p;
+
+	if ((arena = from->modify->arena) == NULL)
+		return (0);
+
+	/* Check for a heap-allocated structure. */
+	for (large = arena->large; large != NULL; large = large->next)
+		if (WT_PAGE_ARENA_LARGE_DATA(large) == addr)
+			break;
+	if (large != NULL) {
+		WT_RET(__arena_init(session, to, &to_arena));
+		WT_PAGE_LOCK(session, from);
+		__arena_large_unlink(arena, large);
+		WT_PAGE_UNLOCK(session, from);
+		__wt_cache_page_inmem_decr(session, from, large->size);
+
+		WT_PAGE_LOCK(session, to);
+		if ((large->next = to_arena->large) != NULL)
+			large->next->prev = large;
+		to_arena->large = large;
+		WT_PAGE_UNLOCK(session, to);
+		__wt_cache_page_inmem_incr(session, to, large->size);
+		return (0);
+	}
+
+	/* Find the chunk, it's either the page's chunk or a shared chunk. */
+#define	WT_PAGE_ARENA_CHUNK_HAS(chunk, addr)				\
+	((addr) >= WT_PAGE_ARENA_CHUNK_DATA(chunk) &&			\
+	    (addr) < WT_PAGE_ARENA_CHUNK_DATA(chunk) + (chunk)->size)
+	for (chunk = arena->chunk; chunk != NULL; chunk = chunk->next)
+		if (WT_PAGE_ARENA_CHUNK_HAS(chunk, addr))
+			break;
+	for (ref = arena->shared;
+	    chunk == NULL && ref != NULL; ref = ref->next)
+		if (WT_PAGE_ARENA_CHUNK_HAS(ref->chunk, addr))
+			chunk = ref->chunk;
+	WT_ASSERT(session, chunk != NULL);
+	if (chunk == NULL)
+		return (0);
+
+	/* Check if the other page already references the chunk. */
+	WT_RET(__arena_init(session, to, &arena));
+	for (ref = arena->shared; ref != NULL; ref = ref->next)
+		if (ref->chunk == chunk)
+			return (0);
+
+	/*
+	 * References are allocated from the heap, not the arena: discarding the
+	 * page walks them as the chunks are released.  The chunk is charged to
+	 * the other page as well, it can't be freed until both are discarded.
+	 */
+	WT_RET(__wt_calloc_def(session, 1, &ref));
+	ref->chunk = chunk;
+	(void)WT_ATOMIC_ADD(chunk->ref, 1);
+	ref->next = arena->shared;
+	arena->shared = ref;
+	__wt_cache_page_inmem_incr(session, to,
+	    WT_ALIGN(sizeof(WT_PAGE_ARENA_CHUNK), 8) + chunk->size +
+	    sizeof(WT_PAGE_ARENA_REF));
+	return (0);
+}
+
+/*
+ * __wt_page_arena_discard --
+ *	Discard a page's arena.
+ */
+void
+__wt_page_arena_discard(WT_SESSION_IMPL *session, WT_PAGE *page)
+{
+	WT_PAGE_ARENA *arena;
+	WT_PAGE_ARENA_CHUNK *chunk, *next_chunk;
+	WT_PAGE_ARENA_LARGE *large, *next_large;
+	WT_PAGE_ARENA_REF *ref, *next_ref;
+
+	if ((arena = page->modify->arena) == NULL)
+		return;
+
+	for (large = arena->large; large != NULL; large = next_large) {
+		next_large = large->next;
+		__wt_free(session, large);
+	}
+
+	for (ref = arena->shared; ref != NULL; ref = next_ref) {
+		next_ref = ref->next;
+		__arena_chunk_release(session, ref->chunk);
+		__wt_free(session, ref);
+	}
+	for (chunk = arena->chunk; chunk != NULL; chunk = next_chunk) {
+		next_chunk = chunk->next;
+		__arena_chunk_release(session, chunk);
+	}
+	__wt_free(session, page->modify->arena);
+}
@@ -13,9 +13,6 @@ static void __free_page_col_var(WT_SESSION_IMPL *, WT_PAGE *);
 static void __free_page_row_int(WT_SESSION_IMPL *, WT_PAGE *);
 static void __free_page_row_leaf(WT_SESSION_IMPL *, WT_PAGE *);
 static void __free_skip_array(WT_SESSION_IMPL *, WT_INSERT_HEAD **, uint32_t);
-static void __free_skip_list(WT_SESSION_IMPL *, WT_INSERT *);
-static void __free_update(WT_SESSION_IMPL *, WT_UPDATE **, uint32_t);
-static void __free_update_list(WT_SESSION_IMPL *, WT_UPDATE *);
 
 /*
  * __wt_page_out --
@@ -78,8 +75,15 @@ __wt_page_out(WT_SESSION_IMPL *session, WT_PAGE **pagep)
 		break;
 	}
 
-	/* Discard any disk image. */
-	if (F_ISSET_ATOMIC(page, WT_PAGE_DISK_ALLOC))
+	/*
+	 * Discard any disk image.  Images read into I/O buffer pool memory go
+	 * back to the pool, in the size class they were allocated from.
+	 */
+	if (F_ISSET_ATOMIC(page, WT_PAGE_DISK_POOL))
+		__wt_buf_pool_free(session, page->dsk,
+		    ((size_t)page->dsk_pool_class + 1) *
+		    S2C(session)->buf_pool->unit);
+	else if (F_ISSET_ATOMIC(page, WT_PAGE_DISK_ALLOC))
 		__wt_overwrite_and_free_len(
 		    session, page->dsk, page->dsk->mem_size);
 	if (F_ISSET_ATOMIC(page, WT_PAGE_DISK_MAPPED))
@@ -126,7 +130,6 @@ __free_page_modify(WT_SESSION_IMPL *session, WT_PAGE *page)
 
 	/* Free the append array. */
 	if ((append = WT_COL_APPEND(page)) != NULL) {
-		__free_skip_list(session, WT_SKIP_FIRST(append));
 		__wt_free(session, append);
 		__wt_free(session, mod->append);
 	}
@@ -156,6 +159,12 @@ __free_page_modify(WT_SESSION_IMPL *session, WT_PAGE *page)
 	}
 	__wt_free(session, page->modify->ovfl_track);
 
+	/*
+	 * Free the WT_INSERT and WT_UPDATE structures: they were allocated from
+	 * the page's arena, there's no need to walk the lists.
+	 */
+	__wt_page_arena_discard(session, page);
+
 	__wt_free(session, page->modify);
 }
 
@@ -255,8 +264,10 @@ __free_page_row_leaf(WT_SESSION_IMPL *session, WT_PAGE *page)
 		__free_skip_array(session, page->u.row.ins, page->entries + 1);
 
 	/* Free the update array. */
-	if (page->u.row.upd != NULL)
-		__free_update(session, page->u.row.upd, page->entries);
+	__wt_free(session, page->u.row.upd);
+
+	/* Free the search hash index. */
+	__wt_free(session, page->u.row.srch_hash);
 }
 
 /*
@@ -270,70 +281,13 @@ __free_skip_array(
 	WT_INSERT_HEAD **head;
 
 	/*
-	 * For each non-NULL slot in the page's array of inserts, free the
-	 * linked list anchored in that slot.
+	 * Free the skip list header in each non-NULL slot of the page's array
+	 * of inserts; the lists themselves are in the page's arena.
 	 */
 	for (head = head_arg; entries > 0; --entries, ++head)
-		if (*head != NULL) {
-			__free_skip_list(session, WT_SKIP_FIRST(*head));
+		if (*head != NULL)
 			__wt_free(session, *head);
-		}
 
 	/* Free the header array. */
 	__wt_free(session, head_arg);
 }
-
-/*
- * __free_skip_list --
- *	Walk a WT_INSERT forward-linked list and free the per-thread combination
- * of a WT_INSERT structure and its associated chain of WT_UPDATE structures.
- */
-static void
-__free_skip_list(WT_SESSION_IMPL *session, WT_INSERT *ins)
-{
-	WT_INSERT *next;
-
-	for (; ins != NULL; ins = next) {
-		__free_update_list(session, ins->upd);
-		next = WT_SKIP_NEXT(ins);
-		__wt_free(session, ins);
-	}
-}
-
-/*
- * __free_update --
- *	Discard the update array.
- */
-static void
-__free_update(
-    WT_SESSION_IMPL *session, WT_UPDATE **update_head, uint32_t entries)
-{
-	WT_UPDATE **updp;
-
-	/*
-	 * For each non-NULL slot in the page's array of updates, free the
-	 * linked list anchored in that slot.
-	 */
-	for (updp = update_head; entries > 0; --entries, ++updp)
-		if (*updp != NULL)
-			__free_update_list(session, *updp);
-
-	/* Free the update array. */
-	__wt_free(session, update_head);
-}
-
-/*
- * __free_update_list --
- *	Walk a WT_UPDATE forward-linked list and free the per-thread combination
- *	of a WT_UPDATE structure and its associated data.
- */
-static void
-__free_update_list(WT_SESSION_IMPL *session, WT_UPDATE *upd)
-{
-	WT_UPDATE *next;
-
-	do {
-		next = upd->next;
-		__wt_free(session, upd);
-	} while ((upd = next) != NULL);
-}
@@ -10,17 +10,21 @@
 static void __evict_init_candidate(
     WT_SESSION_IMPL *, WT_EVICT_ENTRY *, WT_PAGE *);
 static int  __evict_lru(WT_SESSION_IMPL *, int);
-static int  __evict_lru_cmp(const void *, const void *);
+static int  __evict_pass(WT_SESSION_IMPL *);
+static void __evict_select(WT_EVICT_ENTRY *, uint32_t, uint32_t);
 static int  __evict_walk(WT_SESSION_IMPL *, uint32_t *, int);
 static int  __evict_walk_file(WT_SESSION_IMPL *, u_int *, int);
-static int  __evict_worker(WT_SESSION_IMPL *);
+static void *__evict_worker(void *);
+static int  __evict_worker_start(WT_SESSION_IMPL *);
+static int  __evict_worker_stop(WT_SESSION_IMPL *);
 
 /*
  * __evict_read_gen --
- *	Get the adjusted read generation for an eviction entry.
+ *	Get the adjusted read generation for an eviction entry, skewing pages
+ * in the cache's protected segment by the given amount.
  */
 static inline uint64_t
-__evict_read_gen(const WT_EVICT_ENTRY *entry)
+__evict_read_gen(const WT_EVICT_ENTRY *entry, uint64_t protected_skew)
 {
 	WT_PAGE *page;
 	uint64_t read_gen;
@@ -43,27 +47,71 @@ __evict_read_gen(const WT_EVICT_ENTRY *entry)
 	    !__wt_btree_mergeable(page))
 		read_gen += WT_EVICT_INT_SKEW;
 
+	if (F_ISSET_ATOMIC(page, WT_PAGE_PROTECTED))
+		read_gen += protected_skew;
+
 	return (read_gen);
 }
 
 /*
- * __evict_lru_cmp --
- *	Qsort function: sort the eviction array.
+ * __evict_select --
+ *	Partially order the eviction array: move the k entries with the lowest
+ * scores into the first k slots, in no particular order.  This is a
+ * quickselect, linear on average, where sorting the whole array is not.
  */
-static int
-__evict_lru_cmp(const void *a, const void *b)
+static void
+__evict_select(WT_EVICT_ENTRY *evict, uint32_t entries, uint32_t k)
 {
-	uint64_t a_lru, b_lru;
+	WT_EVICT_ENTRY tmp;
+	uint64_t a, b, c, pivot;
+	uint32_t i, j, left, right;
+
+	if (k == 0 || k >= entries)
+		return;
 
-	a_lru = __evict_read_gen(a);
-	b_lru = __evict_read_gen(b);
+	for (left = 0, right = entries - 1; left < right;) {
+		/* Median-of-three pivot. */
+		a = evict[left].score;
+		b = evict[left + (right - left) / 2].score;
+		c = evict[right].score;
+		pivot = a < b ?
+		    (b < c ? b : (a < c ? c : a)) :
+		    (a < c ? a : (b < c ? c : b));
+
+		for (i = left, j = right; i <= j;) {
+			while (evict[i].score < pivot)
+				++i;
+			while (evict[j].score > pivot)
+				--j;
+			if (i <= j) {
+				tmp = evict[i];
+				evict[i] = evict[j];
+				evict[j] = tmp;
+				++i;
+				if (j == 0)
+					break;
+				--j;
+			}
+		}
 
-	return ((a_lru < b_lru) ? -1 : (a_lru == b_lru) ? 0 : 1);
+		/*
+		 * Slots [left, j] are no larger than the pivot, slots
+		 * [i, right] are no smaller: continue in whichever side holds
+		 * the boundary, anything in between equals the pivot.
+		 */
+		if (k <= j)
+			right = j;
+		else if (k >= i)
+			left = i;
+		else
+			break;
+	}
 }
 
 /*
  * __evict_list_clr --
- *	Clear an entry in the LRU eviction list.
+ *	Clear an entry in the LRU eviction list.  The caller must have
+ * exclusive access to the queue, or have claimed the entry's page.
  */
 static inline void
 __evict_list_clr(WT_SESSION_IMPL *session, WT_EVICT_ENTRY *e)
@@ -76,6 +124,96 @@ __evict_list_clr(WT_SESSION_IMPL *session, WT_EVICT_ENTRY *e)
 	e->btree = WT_DEBUG_POINT;
 }
 
+/*
+ * __evict_queue_enter --
+ *	Join a partition of the LRU eviction queue, fails if the queue is being
+ * rearranged.
+ */
+static inline int
+__evict_queue_enter(WT_SESSION_IMPL *session, WT_EVICT_PART **partp)
+{
+	WT_CACHE *cache;
+	WT_EVICT_PART *part;
+
+	cache = S2C(session)->cache;
+	part = &cache->evict_part[session->id % WT_EVICT_QUEUE_PARTS];
+
+	/*
+	 * Publish that we're using the queue, then check if a thread wants
+	 * exclusive access; the atomic increment is a full barrier, pairing
+	 * with the barrier in __evict_queue_lock.
+	 */
+	(void)WT_ATOMIC_ADD(part->active, 1);
+	if (cache->evict_exclusive) {
+		(void)WT_ATOMIC_SUB(part->active, 1);
+		return (EBUSY);
+	}
+	*partp = part;
+	return (0);
+}
+
+/*
+ * __evict_queue_leave --
+ *	Leave a partition of the LRU eviction queue.
+ */
+static inline void
+__evict_queue_leave(WT_EVICT_PART *part)
+{
+	(void)WT_ATOMIC_SUB(part->active, 1);
+}
+
+/*
+ * __evict_queue_lock --
+ *	Get exclusive access to the LRU eviction queue: wait for threads
+ * removing pages from the queue to drain.
+ */
+static void
+__evict_queue_lock(WT_SESSION_IMPL *session)
+{
+	WT_CACHE *cache;
+	u_int i;
+
+	cache = S2C(session)->cache;
+
+	__wt_spin_lock(session, &cache->evict_lock);
+	cache->evict_exclusive = 1;
+	WT_FULL_BARRIER();
+	for (i = 0; i < WT_EVICT_QUEUE_PARTS; i++)
+		while (cache->evict_part[i].active != 0)
+			__wt_yield();
+}
+
+/*
+ * __evict_queue_unlock --
+ *	Release exclusive access to the LRU eviction queue.
+ */
+static void
+__evict_queue_unlock(WT_SESSION_IMPL *session)
+{
+	WT_CACHE *cache;
+
+	cache = S2C(session)->cache;
+
+	WT_PUBLISH(cache->evict_exclusive, 0);
+	__wt_spin_unlock(session, &cache->evict_lock);
+}
+
+/*
+ * __evict_queue_empty --
+ *	Return if the first "limit" slots of the LRU eviction queue have all
+ * been handed out.
+ */
+static inline int
+__evict_queue_empty(WT_CACHE *cache, uint32_t limit)
+{
+	u_int i;
+
+	for (i = 0; i < WT_EVICT_QUEUE_PARTS; i++)
+		if (cache->evict_part[i].next < limit)
+			return (0);
+	return (1);
+}
+
 /*
  * __wt_evict_list_clr_page --
  *	Make sure a page is not in the LRU eviction list.  This called from the
@@ -87,7 +225,7 @@ __wt_evict_list_clr_page(WT_SESSION_IMPL *session, WT_PAGE *page)
 {
 	WT_CACHE *cache;
 	WT_EVICT_ENTRY *evict;
-	uint32_t i, elem;
+	WT_EVICT_PART *part;
 
 	WT_ASSERT(session, WT_PAGE_IS_ROOT(page) ||
 	    page->ref->page != page ||
@@ -99,18 +237,26 @@ __wt_evict_list_clr_page(WT_SESSION_IMPL *session, WT_PAGE *page)
 		return;
 
 	cache = S2C(session)->cache;
-	__wt_spin_lock(session, &cache->evict_lock);
-
-	elem = cache->evict_max;
-	for (i = 0, evict = cache->evict; i < elem; i++, evict++)
-		if (evict->page == page) {
-			__evict_list_clr(session, evict);
-			break;
-		}
 
-	WT_ASSERT(session, !F_ISSET_ATOMIC(page, WT_PAGE_EVICT_LRU));
+	/*
+	 * The page's queue slot can't change while we're using the queue: if
+	 * the page is still in its slot, claim and clear the slot.
+	 */
+	while (__evict_queue_enter(session, &part) != 0)
+		__wt_yield();
+	evict = cache->evict + page->evict_slot;
+	if (evict->page == page && WT_ATOMIC_CAS(evict->page, page, NULL)) {
+		F_CLR_ATOMIC(page, WT_PAGE_EVICT_LRU);
+		evict->btree = WT_DEBUG_POINT;
+	}
+	__evict_queue_leave(part);
 
-	__wt_spin_unlock(session, &cache->evict_lock);
+	/*
+	 * If another thread claimed the page first, it's still looking at the
+	 * page: wait for it to finish, it clears the flag when it's done.
+	 */
+	while (F_ISSET_ATOMIC(page, WT_PAGE_EVICT_LRU))
+		__wt_yield();
 }
 
 /*
@@ -160,8 +306,13 @@ __wt_cache_evict_server(void *arg)
 	cache = conn->cache;
 
 	while (F_ISSET(conn, WT_CONN_EVICTION_RUN)) {
+		/* Start the minimum number of eviction workers. */
+		while (cache->evict_workers < cache->evict_workers_min &&
+		    cache->evict_workers < cache->evict_workers_open)
+			WT_ERR(__evict_worker_start(session));
+
 		/* Evict pages from the cache as needed. */
-		WT_ERR(__evict_worker(session));
+		WT_ERR(__evict_pass(session));
 
 		if (!F_ISSET(conn, WT_CONN_EVICTION_RUN))
 			break;
@@ -174,6 +325,10 @@ __wt_cache_evict_server(void *arg)
 		WT_VERBOSE_ERR(session, evictserver, "waking");
 	}
 
+	/* Shut down any eviction worker threads. */
+	while (cache->evict_workers > 0)
+		WT_ERR(__evict_worker_stop(session));
+
 	WT_VERBOSE_ERR(session, evictserver, "exiting");
 
 	if (ret == 0) {
@@ -203,10 +358,218 @@ err:		WT_PANIC_ERR(session, ret, "eviction server error");
 
 /*
  * __evict_worker --
+ *	Eviction worker thread: evict pages queued by the eviction server.
+ */
+static void *
+__evict_worker(void *arg)
+{
+	WT_CACHE *cache;
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+	WT_EVICT_WORKER *worker;
+	WT_SESSION_IMPL *session;
+
+	worker = arg;
+	session = worker->session;
+	conn = S2C(session);
+	cache = conn->cache;
+
+	while (F_ISSET(conn, WT_CONN_EVICTION_RUN) &&
+	    F_ISSET(worker, WT_EVICT_WORKER_RUN)) {
+		/*
+		 * Reconcile and discard pages until the queue is drained:
+		 * EBUSY is returned if a page fails eviction because it's
+		 * unavailable, continue in that case.
+		 */
+		while ((ret = __wt_evict_lru_page(session, 0)) == 0 ||
+		    ret == EBUSY)
+			if (ret == 0) {
+				++worker->pages_evicted;
+				WT_STAT_FAST_CONN_INCR(
+				    session, cache_eviction_worker_evicting);
+			}
+		WT_ERR_NOTFOUND_OK(ret);
+
+		/*
+		 * If the eviction server is waiting for the queue to drain,
+		 * tell it to walk for more candidates, then wait for the
+		 * queue to be re-populated.
+		 */
+		if (F_ISSET(cache, WT_EVICT_ACTIVE))
+			WT_ERR(__wt_cond_signal(session, cache->evict_cond));
+		WT_ERR_TIMEDOUT_OK(
+		    __wt_cond_wait(session, cache->evict_waiter_cond, 100000));
+	}
+
+	WT_VERBOSE_ERR(session, evictserver,
+	    "worker %u exiting, %" PRIu64 " pages evicted",
+	    worker->id, worker->pages_evicted);
+
+	if (0) {
+err:		WT_PANIC_ERR(session, ret, "eviction worker error");
+	}
+	return (NULL);
+}
+
+/*
+ * __evict_worker_start --
+ *	Start an additional eviction worker thread.
+ */
+static int
+__evict_worker_start(WT_SESSION_IMPL *session)
+{
+	WT_CACHE *cache;
+	WT_EVICT_WORKER *worker;
+
+	cache = S2C(session)->cache;
+
+	worker = &cache->evict_workctx[cache->evict_workers];
+	WT_ASSERT(session, worker->session != NULL);
+
+	worker->id = cache->evict_workers;
+	F_SET(worker, WT_EVICT_WORKER_RUN);
+	WT_RET(__wt_thread_create(
+	    session, &worker->tid, __evict_worker, worker));
+	++cache->evict_workers;
+	WT_STAT_FAST_CONN_SET(
+	    session, cache_eviction_workers, cache->evict_workers);
+
+	WT_VERBOSE_RET(session, evictserver,
+	    "started eviction worker %u", worker->id);
+	return (0);
+}
+
+/*
+ * __evict_worker_stop --
+ *	Stop the most recently started eviction worker thread.
+ */
+static int
+__evict_worker_stop(WT_SESSION_IMPL *session)
+{
+	WT_CACHE *cache;
+	WT_EVICT_WORKER *worker;
+
+	cache = S2C(session)->cache;
+
+	worker = &cache->evict_workctx[--cache->evict_workers];
+	WT_STAT_FAST_CONN_SET(
+	    session, cache_eviction_workers, cache->evict_workers);
+
+	F_CLR(worker, WT_EVICT_WORKER_RUN);
+	WT_RET(__wt_cond_signal(session, cache->evict_waiter_cond));
+	WT_RET(__wt_thread_join(session, worker->tid));
+
+	WT_VERBOSE_RET(session, evictserver,
+	    "stopped eviction worker %u", worker->id);
+	return (0);
+}
+
+/*
+ * __wt_evict_workers_open --
+ *	Open sessions for any configured eviction workers that don't yet have
+ * one.
+ *
+ *	Worker sessions are opened by application threads (at open and when the
+ * connection is reconfigured), never by the eviction server: opening a session
+ * acquires the connection spinlock, which could deadlock the server.
+ */
+int
+__wt_evict_workers_open(WT_CONNECTION_IMPL *conn)
+{
+	WT_CACHE *cache;
+	WT_EVICT_WORKER *worker;
+
+	cache = conn->cache;
+
+	while (cache->evict_workers_open < cache->evict_workers_max) {
+		worker = &cache->evict_workctx[cache->evict_workers_open];
+		WT_RET(__wt_open_session(
+		    conn, 1, NULL, NULL, &worker->session));
+		worker->session->name = "eviction-worker";
+
+		/* Publish the session before the server can use it. */
+		WT_WRITE_BARRIER();
+		++cache->evict_workers_open;
+	}
+	return (0);
+}
+
+/*
+ * __wt_evict_create --
+ *	Start the eviction server thread.
+ */
+int
+__wt_evict_create(WT_CONNECTION_IMPL *conn)
+{
+	WT_SESSION_IMPL *evict_session, *session;
+
+	session = conn->default_session;
+
+	/*
+	 * The eviction server and worker threads need session handles because
+	 * they are reading/writing pages.  Allocate the sessions here so the
+	 * eviction threads never need to acquire the connection spinlock,
+	 * which can lead to deadlock.
+	 */
+	WT_RET(__wt_evict_workers_open(conn));
+
+	WT_RET(__wt_open_session(conn, 1, NULL, NULL, &evict_session));
+	evict_session->name = "eviction-server";
+	WT_RET(__wt_thread_create(session,
+	    &conn->cache_evict_tid, __wt_cache_evict_server, evict_session));
+	conn->cache_evict_tid_set = 1;
+
+	return (0);
+}
+
+/*
+ * __wt_evict_destroy --
+ *	Destroy the eviction server and worker threads.
+ */
+int
+__wt_evict_destroy(WT_CONNECTION_IMPL *conn)
+{
+	WT_CACHE *cache;
+	WT_DECL_RET;
+	WT_EVICT_WORKER *worker;
+	WT_SESSION *wt_session;
+	WT_SESSION_IMPL *session;
+	u_int i;
+
+	cache = conn->cache;
+	session = conn->default_session;
+
+	/*
+	 * Shut down the eviction server thread, it stops any running worker
+	 * threads before exiting.
+	 */
+	F_CLR(conn, WT_CONN_EVICTION_RUN);
+	if (conn->cache_evict_tid_set) {
+		WT_TRET(__wt_evict_server_wake(session));
+		WT_TRET(__wt_thread_join(session, conn->cache_evict_tid));
+		conn->cache_evict_tid_set = 0;
+	}
+
+	/* Close the worker threads' sessions. */
+	if (cache == NULL || cache->evict_workctx == NULL)
+		return (ret);
+	for (i = 0, worker = cache->evict_workctx;
+	    i < cache->evict_workers_open; i++, worker++) {
+		wt_session = &worker->session->iface;
+		WT_TRET(wt_session->close(wt_session, NULL));
+		worker->session = NULL;
+	}
+	cache->evict_workers_open = 0;
+
+	return (ret);
+}
+
+/*
+ * __evict_pass --
  *	Evict pages from memory.
  */
 static int
-__evict_worker(WT_SESSION_IMPL *session)
+__evict_pass(WT_SESSION_IMPL *session)
 {
 	WT_CACHE *cache;
 	WT_CONNECTION_IMPL *conn;
@@ -216,6 +579,9 @@ __evict_worker(WT_SESSION_IMPL *session)
 	conn = S2C(session);
 	cache = conn->cache;
 
+	/* Get any write-behind threads writing dirty pages. */
+	WT_RET(__wt_write_behind_wake(session));
+
 	/* Evict pages from the cache. */
 	for (loop = 0;; loop++) {
 		/*
@@ -227,8 +593,15 @@ __evict_worker(WT_SESSION_IMPL *session)
 		bytes_max = conn->cache_size;
 		if (bytes_inuse < (cache->eviction_target * bytes_max) / 100 &&
 		    dirty_inuse <
-		    (cache->eviction_dirty_target * bytes_max) / 100)
+		    (cache->eviction_dirty_target * bytes_max) / 100) {
+			/*
+			 * Eviction has caught up: shut down a worker thread if
+			 * there are more running than the configured minimum.
+			 */
+			if (cache->evict_workers > cache->evict_workers_min)
+				WT_RET(__evict_worker_stop(session));
 			break;
+		}
 
 		F_SET(cache, WT_EVICT_ACTIVE);
 		WT_VERBOSE_RET(session, evictserver,
@@ -257,6 +630,20 @@ __evict_worker(WT_SESSION_IMPL *session)
 
 		WT_RET(__evict_lru(session, clean));
 
+		/*
+		 * If the cache is still over the eviction trigger after a
+		 * pass, eviction isn't keeping up: start another worker thread
+		 * if configured.  If the workers have been reconfigured down,
+		 * shut down the extras.
+		 */
+		if (cache->evict_workers > cache->evict_workers_max)
+			WT_RET(__evict_worker_stop(session));
+		else if (__wt_cache_bytes_inuse(cache) >
+		    (cache->eviction_trigger * bytes_max) / 100 &&
+		    cache->evict_workers < cache->evict_workers_max &&
+		    cache->evict_workers < cache->evict_workers_open)
+			WT_RET(__evict_worker_start(session));
+
 		/*
 		 * If we're making progress, keep going; if we're not making
 		 * any progress at all, mark the cache "stuck" and go back to
@@ -374,8 +761,8 @@ __wt_evict_file_exclusive_on(WT_SESSION_IMPL *session)
 	F_SET(btree, WT_BTREE_NO_EVICTION);
 	__wt_spin_unlock(session, &cache->evict_walk_lock);
 
-	/* Hold the evict lock to remove any queued pages from this file. */
-	__wt_spin_lock(session, &cache->evict_lock);
+	/* Lock the queue to remove any queued pages from this file. */
+	__evict_queue_lock(session);
 
 	/* Clear any existing LRU eviction walk for the file. */
 	__wt_evict_clear_tree_walk(session, NULL);
@@ -388,7 +775,7 @@ __wt_evict_file_exclusive_on(WT_SESSION_IMPL *session)
 	for (i = 0, evict = cache->evict; i < elem; i++, evict++)
 		if (evict->btree == btree)
 			__evict_list_clr(session, evict);
-	__wt_spin_unlock(session, &cache->evict_lock);
+	__evict_queue_unlock(session);
 
 	/*
 	 * We have disabled further eviction: wait for concurrent LRU eviction
@@ -515,14 +902,12 @@ int
 __wt_sync_file(WT_SESSION_IMPL *session, int syncop)
 {
 	WT_BTREE *btree;
-	WT_CACHE *cache;
 	WT_DECL_RET;
 	WT_PAGE *page;
 	WT_TXN *txn;
 	uint32_t flags;
 
 	btree = S2BT(session);
-	cache = S2C(session)->cache;
 	page = NULL;
 	txn = &session->txn;
 
@@ -572,9 +957,9 @@ __wt_sync_file(WT_SESSION_IMPL *session, int syncop)
 		 * checkpoint will notice and wait for eviction to complete
 		 * before proceeding.
 		 */
-		__wt_spin_lock(session, &cache->evict_lock);
+		__evict_queue_lock(session);
 		btree->checkpointing = 1;
-		__wt_spin_unlock(session, &cache->evict_lock);
+		__evict_queue_unlock(session);
 
 		/*
 		 * The second pass walks all cache internal pages, waiting for
@@ -630,22 +1015,55 @@ __evict_lru(WT_SESSION_IMPL *session, int clean)
 	WT_CACHE *cache;
 	WT_DECL_RET;
 	WT_EVICT_ENTRY *evict;
-	uint64_t cutoff;
-	uint32_t candidates, entries, i;
+	uint64_t bytes_inuse, cutoff, max_gen, min_gen, protected_skew;
+	uint64_t read_gen;
+	uint32_t candidates, entries, i, n;
 
 	cache = S2C(session)->cache;
 
 	/* Get some more pages to consider for eviction. */
 	WT_RET(__evict_walk(session, &entries, clean));
 
-	/* Sort the list into LRU order and restart. */
-	__wt_spin_lock(session, &cache->evict_lock);
+	/* Choose the oldest pages and restart. */
+	__evict_queue_lock(session);
 
-	qsort(cache->evict,
-	    entries, sizeof(WT_EVICT_ENTRY), __evict_lru_cmp);
+	/*
+	 * If the cache is scan-resistant and its probationary segment holds
+	 * more than its share of the cache, evict probationary pages first.
+	 * The protected segment's size can race with page footprint changes,
+	 * take care it doesn't exceed the cache's size.
+	 */
+	protected_skew = 0;
+	if (cache->eviction_scan_resistant) {
+		bytes_inuse = __wt_cache_bytes_inuse(cache);
+		if (bytes_inuse - WT_MIN(cache->bytes_protected, bytes_inuse) >
+		    (WT_EVICT_PROBATION_PCT * S2C(session)->cache_size) / 100)
+			protected_skew = WT_EVICT_PROTECTED_SKEW;
+	}
 
-	while (entries > 0 && cache->evict[entries - 1].page == NULL)
-		--entries;
+	/*
+	 * Score the entries and compact out the empty slots, tracking the range
+	 * of read generations as we go.  The read generations can change
+	 * under us, so calculate them once, here.
+	 */
+	min_gen = UINT64_MAX;
+	max_gen = 0;
+	for (i = n = 0, evict = cache->evict; i < entries; i++, evict++) {
+		if (evict->page == NULL)
+			continue;
+		if (i != n) {
+			cache->evict[n] = *evict;
+			evict->page = NULL;
+		}
+		read_gen = cache->evict[n].score =
+		    __evict_read_gen(&cache->evict[n], protected_skew);
+		if (read_gen < min_gen)
+			min_gen = read_gen;
+		if (read_gen > max_gen)
+			max_gen = read_gen;
+		++n;
+	}
+	entries = n;
 
 	cache->evict_entries = entries;
 
@@ -656,40 +1074,58 @@ __evict_lru(WT_SESSION_IMPL *session, int clean)
 		 * candidate list, or they may race with the next walk.
 		 */
 		cache->evict_candidates = 0;
-		cache->evict_current = NULL;
-		__wt_spin_unlock(session, &cache->evict_lock);
+		__evict_queue_unlock(session);
 		return (0);
 	}
 
 	WT_ASSERT(session, cache->evict[0].page != NULL);
 
 	/* Find the bottom 25% of read generations. */
-	cutoff = (3 * __evict_read_gen(&cache->evict[0]) +
-	    __evict_read_gen(&cache->evict[entries - 1])) / 4;
+	cutoff = (3 * min_gen + max_gen) / 4;
+	for (i = candidates = 0; i < entries; i++)
+		if (cache->evict[i].score <= cutoff)
+			++candidates;
 
 	/*
 	 * Don't take less than 10% or more than 50% of entries, regardless.
 	 * That said, if there is only one entry, which is normal when
 	 * populating an empty file, don't exclude it.
 	 */
-	for (candidates = 1 + entries / 10;
-	    candidates < entries / 2;
-	    candidates++)
-		if (__evict_read_gen(&cache->evict[candidates]) > cutoff)
-			break;
-	cache->evict_candidates = candidates;
+	if (candidates > entries / 2)
+		candidates = entries / 2;
+	if (candidates < 1 + entries / 10)
+		candidates = 1 + entries / 10;
 
-	/* If we have more than the minimum number of entries, clear them. */
-	if (cache->evict_entries > WT_EVICT_WALK_BASE) {
+	/*
+	 * We don't need the queue in LRU order, only the oldest pages at the
+	 * front of it: if we have more than the minimum number of entries,
+	 * select the oldest and clear the rest; then select the candidates,
+	 * and the oldest half of the candidates, which are the ones the
+	 * eviction server or its workers take.
+	 */
+	if (entries > WT_EVICT_WALK_BASE) {
+		__evict_select(cache->evict, entries, WT_EVICT_WALK_BASE);
 		for (i = WT_EVICT_WALK_BASE, evict = cache->evict + i;
-		    i < cache->evict_entries;
+		    i < entries;
 		    i++, evict++)
 			__evict_list_clr(session, evict);
-		cache->evict_entries = WT_EVICT_WALK_BASE;
+		cache->evict_entries = entries = WT_EVICT_WALK_BASE;
 	}
+	__evict_select(cache->evict, entries, candidates);
+	__evict_select(cache->evict, candidates, candidates / 2);
 
-	cache->evict_current = cache->evict;
-	__wt_spin_unlock(session, &cache->evict_lock);
+	/*
+	 * Selection moved the pages: update their back-pointers to their queue
+	 * slots, then reset the partitions to hand out the new candidates.
+	 */
+	for (i = 0, evict = cache->evict;
+	    i < cache->evict_entries; i++, evict++)
+		if (evict->page != NULL)
+			evict->page->evict_slot = i;
+	for (i = 0; i < WT_EVICT_QUEUE_PARTS; i++)
+		cache->evict_part[i].next = i;
+	cache->evict_candidates = candidates;
+	__evict_queue_unlock(session);
 
 	/*
 	 * Signal any application threads waiting for the eviction queue to
@@ -697,12 +1133,30 @@ __evict_lru(WT_SESSION_IMPL *session, int clean)
 	 */
 	WT_RET(__wt_cond_signal(session, cache->evict_waiter_cond));
 
+	/*
+	 * If there are eviction worker threads, they drain the queue: wait for
+	 * them to work through the server's share of the candidates before
+	 * walking for more.  Don't rely on signals, check periodically.
+	 */
+	if (cache->evict_workers > 0) {
+		candidates = cache->evict_candidates;
+		if (candidates > 1)
+			candidates /= 2;
+		while (F_ISSET(S2C(session), WT_CONN_EVICTION_RUN) &&
+		    !__evict_queue_empty(cache, candidates))
+			WT_RET_TIMEDOUT_OK(
+			    __wt_cond_wait(session, cache->evict_cond, 10000));
+		return (0);
+	}
+
 	/*
 	 * Reconcile and discard some pages: EBUSY is returned if a page fails
 	 * eviction because it's unavailable, continue in that case.
 	 */
 	while ((ret = __wt_evict_lru_page(session, 0)) == 0 || ret == EBUSY)
-		;
+		if (ret == 0)
+			WT_STAT_FAST_CONN_INCR(
+			    session, cache_eviction_server_evicting);
 	return (ret == WT_NOTFOUND ? 0 : ret);
 }
 
@@ -821,8 +1275,14 @@ __evict_init_candidate(
 
 	if (evict->page != NULL)
 		__evict_list_clr(session, evict);
-	evict->page = page;
+
+	/*
+	 * Set the page's back-pointer and the entry's btree before publishing
+	 * the page: threads removing the page from the queue rely on them.
+	 */
+	page->evict_slot = slot;
 	evict->btree = S2BT(session);
+	WT_PUBLISH(evict->page, page);
 
 	/* Mark the page on the list */
 	F_SET_ATOMIC(page, WT_PAGE_EVICT_LRU);
@@ -991,10 +1451,14 @@ static int
 __evict_get_page(
     WT_SESSION_IMPL *session, int is_app, WT_BTREE **btreep, WT_PAGE **pagep)
 {
+	WT_BTREE *btree;
 	WT_CACHE *cache;
 	WT_EVICT_ENTRY *evict;
+	WT_EVICT_PART *mypart, *part;
+	WT_PAGE *page;
 	WT_REF *ref;
-	uint32_t candidates;
+	uint32_t candidates, slot;
+	u_int i;
 
 	cache = S2C(session)->cache;
 	*btreep = NULL;
@@ -1013,19 +1477,14 @@ __evict_get_page(
 	}
 
 	/*
-	 * Avoid the LRU lock if no pages are available.  If there are pages
-	 * available, spin until we get the lock.  If this function returns
-	 * without getting a page to evict, application threads assume there
-	 * are no more pages available and will attempt to wake the eviction
-	 * server.
+	 * If the queue is being rearranged, there are no pages available.  If
+	 * this function returns without getting a page to evict, application
+	 * threads assume there are no more pages available and will attempt
+	 * to wake the eviction server.
 	 */
-	for (;;) {
-		if (cache->evict_current == NULL)
-			return (WT_NOTFOUND);
-		if (__wt_spin_trylock(session, &cache->evict_lock) == 0)
-			break;
-		__wt_yield();
-	}
+	if (cache->evict_candidates == 0 ||
+	    __evict_queue_enter(session, &mypart) != 0)
+		return (WT_NOTFOUND);
 
 	/*
 	 * The eviction server only tries to evict half of the pages before
@@ -1035,50 +1494,63 @@ __evict_get_page(
 	if (!is_app && candidates > 1)
 		candidates /= 2;
 
-	/* Get the next page queued for eviction. */
-	while ((evict = cache->evict_current) != NULL &&
-	    evict < cache->evict + candidates &&
-	    evict->page != NULL) {
-		WT_ASSERT(session, evict->btree != NULL);
-
-		/* Move to the next item. */
-		++cache->evict_current;
+	/*
+	 * Get the next page queued for eviction: start with our own partition
+	 * and move on to the others when it's exhausted.
+	 */
+	for (i = 0, part = mypart; i < WT_EVICT_QUEUE_PARTS; i++) {
+		while (part->next < candidates) {
+			slot = WT_ATOMIC_ADD(part->next,
+			    WT_EVICT_QUEUE_PARTS) - WT_EVICT_QUEUE_PARTS;
+			if (slot >= candidates)
+				break;
+			evict = cache->evict + slot;
+			if ((page = evict->page) == NULL)
+				continue;
+			btree = evict->btree;
 
-		/*
-		 * Lock the page while holding the eviction mutex to prevent
-		 * multiple attempts to evict it.  For pages that are already
-		 * being evicted, this operation will fail and we will move on.
-		 */
-		ref = evict->page->ref;
-		WT_ASSERT(session, evict->page == ref->page);
+			/*
+			 * Claim the entry: once the page pointer is cleared,
+			 * no other thread will look at the page through the
+			 * queue.  If we lose the race, move on.
+			 */
+			if (!WT_ATOMIC_CAS(evict->page, page, NULL))
+				continue;
+			evict->btree = WT_DEBUG_POINT;
 
-		if (!WT_ATOMIC_CAS(ref->state, WT_REF_MEM, WT_REF_LOCKED)) {
-			__evict_list_clr(session, evict);
-			continue;
-		}
+			/*
+			 * Lock the page before clearing its queue flag, that
+			 * prevents multiple attempts to evict it: a thread
+			 * already evicting the page waits for the flag to be
+			 * cleared before freeing the page.  For pages that are
+			 * already being evicted, this operation will fail and
+			 * we will move on.
+			 */
+			ref = page->ref;
+			WT_ASSERT(session, page == ref->page);
+			if (!WT_ATOMIC_CAS(
+			    ref->state, WT_REF_MEM, WT_REF_LOCKED)) {
+				F_CLR_ATOMIC(page, WT_PAGE_EVICT_LRU);
+				continue;
+			}
 
-		/*
-		 * Increment the LRU count in the btree handle to prevent it
-		 * from being closed under us.
-		 */
-		(void)WT_ATOMIC_ADD(evict->btree->lru_count, 1);
+			/*
+			 * Increment the LRU count in the btree handle to
+			 * prevent it from being closed under us.
+			 */
+			(void)WT_ATOMIC_ADD(btree->lru_count, 1);
+			F_CLR_ATOMIC(page, WT_PAGE_EVICT_LRU);
 
-		*btreep = evict->btree;
-		*pagep = evict->page;
+			*btreep = btree;
+			*pagep = page;
+			goto done;
+		}
 
-		/*
-		 * Remove the entry so we never try to reconcile the same page
-		 * on reconciliation error.
-		 */
-		__evict_list_clr(session, evict);
-		break;
+		if (++part == cache->evict_part + WT_EVICT_QUEUE_PARTS)
+			part = cache->evict_part;
 	}
 
-	/* Clear the current pointer if there are no more candidates. */
-	if (evict >= cache->evict + cache->evict_candidates)
-		cache->evict_current = NULL;
-	__wt_spin_unlock(session, &cache->evict_lock);
-
+done:	__evict_queue_leave(mypart);
 	return ((*pagep == NULL) ? WT_NOTFOUND : 0);
 }
 
@@ -1115,6 +1587,8 @@ __wt_evict_lru_page(WT_SESSION_IMPL *session, int is_app)
 	cache = S2C(session)->cache;
 	if (ret == 0 && F_ISSET(cache, WT_EVICT_NO_PROGRESS | WT_EVICT_STUCK))
 		F_CLR(cache, WT_EVICT_NO_PROGRESS | WT_EVICT_STUCK);
+	if (ret == 0 && is_app)
+		WT_STAT_FAST_CONN_INCR(session, cache_eviction_app);
 
 	return (ret);
 }
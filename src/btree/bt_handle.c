@@ -250,6 +250,14 @@ __btree_conf(WT_SESSION_IMPL *session, WT_CKPT *ckpt)
 			F_CLR(btree, WT_BTREE_NO_EVICTION);
 	}
 
+	/* Cursor scan read-ahead */
+	WT_RET(__wt_config_gets(session, cfg, "read_ahead", &cval));
+	btree->read_ahead = (uint32_t)cval.val;
+
+	/* Leaf page hash indexes compare keys as raw bytes. */
+	WT_RET(__wt_config_gets(session, cfg, "leaf_hash_index", &cval));
+	btree->leaf_hash_index = cval.val != 0 && btree->collator == NULL;
+
 	/* Checksums */
 	WT_RET(__wt_config_gets(session, cfg, "checksum", &cval));
 	if (WT_STRING_MATCH("on", cval.str, cval.len))
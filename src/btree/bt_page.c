@@ -28,11 +28,14 @@ __wt_page_in_func(
 #endif
     )
 {
+	WT_CACHE *cache;
 	WT_DECL_RET;
 	WT_PAGE *page;
-	int busy, force_attempts, oldgen;
+	int busy, force_attempts, oldgen, read;
+
+	cache = S2C(session)->cache;
 
-	for (force_attempts = oldgen = 0;;) {
+	for (force_attempts = oldgen = read = 0;;) {
 		switch (ref->state) {
 		case WT_REF_DISK:
 		case WT_REF_DELETED:
@@ -43,6 +46,7 @@ __wt_page_in_func(
 			WT_RET(__wt_cache_full_check(session));
 			WT_RET(__wt_cache_read(session, parent, ref));
 			oldgen = F_ISSET(session, WT_SESSION_NO_CACHE) ? 1 : 0;
+			read = 1;
 			continue;
 		case WT_REF_LOCKED:
 		case WT_REF_READING:
@@ -72,6 +76,19 @@ __wt_page_in_func(
 			WT_ASSERT(session,
 			    page != NULL && !WT_PAGE_IS_ROOT(page));
 
+			/*
+			 * Pages read by a prefetch thread are treated as if
+			 * the first thread to use them had read them.
+			 */
+			if (F_ISSET_ATOMIC(page, WT_PAGE_PREFETCH)) {
+				F_CLR_ATOMIC(page, WT_PAGE_PREFETCH);
+				WT_STAT_FAST_CONN_INCR(
+				    session, cache_prefetch_used);
+				oldgen = F_ISSET(
+				    session, WT_SESSION_NO_CACHE) ? 1 : 0;
+				read = 1;
+			}
+
 			/*
 			 * Force evict pages that are too big.  Only do this
 			 * check if there is a chance of eviction succeeding.
@@ -93,13 +110,33 @@ __wt_page_in_func(
 			}
 
 			/*
-			 * If this page has ever been considered for eviction,
-			 * and its generation is aging, update it.
+			 * Sessions configured to not trash the cache leave the
+			 * page's LRU alone.
 			 */
-			if (page->read_gen != WT_READ_GEN_NOTSET &&
-			    page->read_gen < __wt_cache_read_gen(session))
-				page->read_gen =
-				    __wt_cache_read_gen_set(session);
+			if (!F_ISSET(session, WT_SESSION_NO_CACHE)) {
+				/*
+				 * In a scan-resistant cache, pages are read
+				 * into the probationary segment, and move to
+				 * the protected segment when they're used
+				 * again: pages only used once, for example by
+				 * a scan, never do.
+				 */
+				if (!read &&
+				    cache->eviction_scan_resistant &&
+				    !F_ISSET_ATOMIC(page, WT_PAGE_PROTECTED))
+					__wt_cache_page_protect(session, page);
+
+				/*
+				 * If this page has ever been considered for
+				 * eviction, and its generation is aging,
+				 * update it.
+				 */
+				if (page->read_gen != WT_READ_GEN_NOTSET &&
+				    page->read_gen <
+				    __wt_cache_read_gen(session))
+					page->read_gen =
+					    __wt_cache_read_gen_set(session);
+			}
 
 			/*
 			 * If we read the page and we are configured to not
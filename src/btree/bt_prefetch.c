@@ -0,0 +1,310 @@
+/*-
+ * Copyright (c) 2008-2013 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+static int   __pf_read(WT_SESSION_IMPL *, WT_PREFETCH_ENTRY *);
+static void *__pf_server(void *);
+
+/*
+ * __wt_prefetch_create --
+ *	Start the prefetch threads.
+ */
+int
+__wt_prefetch_create(WT_CONNECTION_IMPL *conn, const char *cfg[])
+{
+	WT_CACHE *cache;
+	WT_CONFIG_ITEM cval;
+	WT_SESSION_IMPL *session;
+	u_int i, threads;
+
+	session = conn->default_session;
+	cache = conn->cache;
+
+	WT_RET(__wt_config_gets(session, cfg, "prefetch.threads", &cval));
+	threads = (u_int)cval.val;
+
+	/* If not configured, we're done. */
+	if (threads == 0)
+		return (0);
+
+	WT_RET(__wt_spin_init(session, &cache->pf_lock, "prefetch queue"));
+	WT_RET(__wt_cond_alloc(
+	    session, "prefetch threads", 0, &cache->pf_cond));
+	WT_RET(__wt_calloc_def(session, WT_PREFETCH_QUEUE, &cache->pf_queue));
+	WT_RET(__wt_calloc_def(session, WT_PREFETCH_MAX, &cache->pf_session));
+	WT_RET(__wt_calloc_def(session, WT_PREFETCH_MAX, &cache->pf_tid));
+
+	/* Each prefetch thread gets its own session. */
+	for (i = 0; i < threads; i++) {
+		WT_RET(__wt_open_session(
+		    conn, 1, NULL, NULL, &cache->pf_session[i]));
+		cache->pf_session[i]->name = "prefetch";
+	}
+
+	for (; cache->pf_threads < threads; ++cache->pf_threads)
+		WT_RET(__wt_thread_create(session,
+		    &cache->pf_tid[cache->pf_threads],
+		    __pf_server, cache->pf_session[cache->pf_threads]));
+
+	return (0);
+}
+
+/*
+ * __wt_prefetch_destroy --
+ *	Shut down the prefetch threads and discard any queued pages.
+ */
+int
+__wt_prefetch_destroy(WT_CONNECTION_IMPL *conn)
+{
+	WT_CACHE *cache;
+	WT_DECL_RET;
+	WT_PREFETCH_ENTRY *pf;
+	WT_SESSION *wt_session;
+	WT_SESSION_IMPL *session;
+	u_int i;
+
+	session = conn->default_session;
+	if ((cache = conn->cache) == NULL || cache->pf_queue == NULL)
+		return (0);
+
+	if (cache->pf_threads != 0) {
+		WT_TRET(__wt_cond_signal(session, cache->pf_cond));
+		for (i = 0; i < cache->pf_threads; i++)
+			WT_TRET(__wt_thread_join(session, cache->pf_tid[i]));
+		cache->pf_threads = 0;
+	}
+	WT_TRET(__wt_cond_destroy(session, &cache->pf_cond));
+
+	/*
+	 * Give back any pages still queued, they hold their files open and
+	 * their parent pages in memory.
+	 */
+	for (; cache->pf_count > 0; --cache->pf_count) {
+		pf = &cache->pf_queue[cache->pf_first];
+		cache->pf_first = (cache->pf_first + 1) % WT_PREFETCH_QUEUE;
+		WT_PUBLISH(pf->ref->state, WT_REF_DISK);
+		(void)WT_ATOMIC_SUB(pf->btree->lru_count, 1);
+	}
+
+	/* Close the threads' sessions. */
+	if (cache->pf_session != NULL)
+		for (i = 0; i < WT_PREFETCH_MAX; i++) {
+			if (cache->pf_session[i] == NULL)
+				break;
+			wt_session = &cache->pf_session[i]->iface;
+			WT_TRET(wt_session->close(wt_session, NULL));
+		}
+	__wt_free(session, cache->pf_session);
+	__wt_free(session, cache->pf_tid);
+	__wt_free(session, cache->pf_queue);
+	__wt_spin_destroy(session, &cache->pf_lock);
+
+	return (ret);
+}
+
+/*
+ * __wt_prefetch_queue --
+ *	Queue a page for the prefetch threads to read.  Returns EBUSY if the
+ * queue is full, and WT_NOTFOUND if the page can't be queued because it's
+ * no longer on disk or its file is being closed.
+ */
+int
+__wt_prefetch_queue(WT_SESSION_IMPL *session, WT_PAGE *parent, WT_REF *ref)
+{
+	WT_BTREE *btree;
+	WT_CACHE *cache;
+	WT_PREFETCH_ENTRY *pf;
+	int empty;
+
+	btree = S2BT(session);
+	cache = S2C(session)->cache;
+
+	if (cache->pf_count >= WT_PREFETCH_QUEUE) {
+		WT_STAT_FAST_CONN_INCR(session, cache_prefetch_skipped);
+		return (EBUSY);
+	}
+
+	/*
+	 * Use the LRU count to hold the file open while the page is queued:
+	 * it's how eviction and the write-behind threads hold files, closing
+	 * a file sets the "no eviction" flag under the walk lock, then waits
+	 * for the count to drain.
+	 */
+	__wt_spin_lock(session, &cache->evict_walk_lock);
+	if (F_ISSET(btree, WT_BTREE_NO_EVICTION)) {
+		__wt_spin_unlock(session, &cache->evict_walk_lock);
+		return (WT_NOTFOUND);
+	}
+	(void)WT_ATOMIC_ADD(btree->lru_count, 1);
+	__wt_spin_unlock(session, &cache->evict_walk_lock);
+
+	/*
+	 * Queued pages are in the WT_REF_READING state: threads wanting the
+	 * page wait for the prefetch thread to read it, the page can't be read
+	 * twice, and its parent page can't be evicted.
+	 */
+	if (ref->state != WT_REF_DISK ||
+	    !WT_ATOMIC_CAS(ref->state, WT_REF_DISK, WT_REF_READING)) {
+		(void)WT_ATOMIC_SUB(btree->lru_count, 1);
+		return (WT_NOTFOUND);
+	}
+
+	__wt_spin_lock(session, &cache->pf_lock);
+	if (cache->pf_count >= WT_PREFETCH_QUEUE) {
+		__wt_spin_unlock(session, &cache->pf_lock);
+		WT_PUBLISH(ref->state, WT_REF_DISK);
+		(void)WT_ATOMIC_SUB(btree->lru_count, 1);
+		WT_STAT_FAST_CONN_INCR(session, cache_prefetch_skipped);
+		return (EBUSY);
+	}
+	pf = &cache->pf_queue[
+	    (cache->pf_first + cache->pf_count) % WT_PREFETCH_QUEUE];
+	pf->btree = btree;
+	pf->parent = parent;
+	pf->ref = ref;
+	empty = cache->pf_count++ == 0;
+	__wt_spin_unlock(session, &cache->pf_lock);
+
+	WT_STAT_FAST_CONN_INCR(session, cache_prefetch_queued);
+	return (empty ? __wt_cond_signal(session, cache->pf_cond) : 0);
+}
+
+/*
+ * __pf_server --
+ *	A prefetch thread.
+ */
+static void *
+__pf_server(void *arg)
+{
+	WT_CACHE *cache;
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+	WT_PREFETCH_ENTRY pf;
+	WT_SESSION_IMPL *session;
+	int found;
+
+	session = arg;
+	conn = S2C(session);
+	cache = conn->cache;
+
+	while (F_ISSET(conn, WT_CONN_SERVER_RUN)) {
+		__wt_spin_lock(session, &cache->pf_lock);
+		if ((found = cache->pf_count > 0) != 0) {
+			pf = cache->pf_queue[cache->pf_first];
+			cache->pf_first =
+			    (cache->pf_first + 1) % WT_PREFETCH_QUEUE;
+			--cache->pf_count;
+		}
+		__wt_spin_unlock(session, &cache->pf_lock);
+		if (!found) {
+			WT_ERR_TIMEDOUT_OK(
+			    __wt_cond_wait(session, cache->pf_cond, 100000));
+			continue;
+		}
+
+		WT_WITH_BTREE(session, pf.btree,
+		    ret = __pf_read(session, &pf));
+		(void)WT_ATOMIC_SUB(pf.btree->lru_count, 1);
+
+		/*
+		 * Other threads may be waiting for queued pages, so a failed
+		 * read must not stop the thread.  The page goes back to the
+		 * on-disk state, the failure repeats for whoever reads it next.
+		 */
+		if (ret != 0) {
+			__wt_err(session, ret, "prefetch read failed");
+			ret = 0;
+		}
+	}
+
+	if (0) {
+err:		__wt_err(session, ret, "prefetch thread error");
+	}
+	return (NULL);
+}
+
+/*
+ * __pf_read --
+ *	Read a queued page into the cache.
+ */
+static int
+__pf_read(WT_SESSION_IMPL *session, WT_PREFETCH_ENTRY *pf)
+{
+	WT_BTREE *btree;
+	WT_CACHE *cache;
+	WT_DECL_RET;
+	int full;
+
+	btree = S2BT(session);
+	cache = S2C(session)->cache;
+
+	/*
+	 * Don't read the page if the file is being closed or compacted, or if
+	 * the cache is full enough eviction is running: prefetch shouldn't
+	 * push out pages that are in use.
+	 */
+	if ((ret = __wt_eviction_check(session, &full, 0)) != 0 ||
+	    F_ISSET(btree, WT_BTREE_NO_EVICTION) ||
+	    full >= (int)cache->eviction_trigger) {
+		WT_PUBLISH(pf->ref->state, WT_REF_DISK);
+		WT_STAT_FAST_CONN_INCR(session, cache_prefetch_skipped);
+		return (ret);
+	}
+
+	WT_RET(__wt_cache_read_prefetch(session, pf->parent, pf->ref));
+	WT_STAT_FAST_CONN_INCR(session, cache_prefetch_read);
+	return (0);
+}
+
+/*
+ * __wt_prefetch_range --
+ *	Queue the leaf pages between two cursor positions for the prefetch
+ * threads.
+ */
+int
+__wt_prefetch_range(WT_SESSION_IMPL *session,
+    WT_CURSOR_BTREE *start, WT_CURSOR_BTREE *stop)
+{
+	WT_CACHE *cache;
+	WT_DECL_RET;
+	WT_PAGE *page;
+
+	cache = S2C(session)->cache;
+	page = NULL;
+
+	/*
+	 * Start from the start cursor's page, or the beginning of the tree.
+	 * The walk releases the page it starts from, take our own hazard
+	 * pointer on the cursor's page.  If the cursor's page is the root,
+	 * the tree has a single page, there's nothing to prefetch.
+	 */
+	if (start != NULL && start->page != NULL) {
+		page = start->page;
+		if (WT_PAGE_IS_ROOT(page) ||
+		    (stop != NULL && stop->page == page))
+			return (0);
+		WT_RET(__wt_page_in(session, page->parent, page->ref));
+	}
+
+	/*
+	 * Walk the leaf pages: the walk queues the pages that aren't in memory
+	 * rather than reading them, and returns the pages that are.  Stop when
+	 * we reach the stop cursor's page, or if the queue fills.
+	 */
+	for (;;) {
+		WT_ERR(__wt_tree_walk(
+		    session, &page, WT_TREE_PREFETCH | WT_TREE_SKIP_INTL));
+		if (page == NULL ||
+		    (stop != NULL && stop->page == page) ||
+		    cache->pf_count >= WT_PREFETCH_QUEUE)
+			break;
+	}
+
+err:	WT_TRET(__wt_page_release(session, page));
+	return (ret);
+}
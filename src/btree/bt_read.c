@@ -22,17 +22,17 @@ __cache_read_row_deleted(
 	btree = S2BT(session);
 
 	/*
-	 * Give the page a modify structure.
+	 * Give the page a modify structure, the deleted items are allocated
+	 * from the page's arena.
 	 *
 	 * If the tree is already dirty and so will be written, mark the page
 	 * dirty.  (We'd like to free the deleted pages, but if the handle is
 	 * read-only or if the application never modifies the tree, we're not
 	 * able to do so.)
 	 */
-	if (btree->modified) {
-		WT_RET(__wt_page_modify_init(session, page));
+	WT_RET(__wt_page_modify_init(session, page));
+	if (btree->modified)
 		__wt_page_modify_set(session, page);
-	}
 
 	/* Allocate the update array. */
 	WT_RET(__wt_calloc_def(session, page->entries, &upd_array));
@@ -40,7 +40,8 @@ __cache_read_row_deleted(
 
 	/* Fill in the update array with deleted items. */
 	for (i = 0; i < page->entries; ++i) {
-		WT_RET(__wt_calloc_def(session, 1, &upd));
+		WT_RET(__wt_page_arena_alloc(
+		    session, page, sizeof(WT_UPDATE), &upd));
 		upd->next = upd_array[i];
 		upd_array[i] = upd;
 
@@ -48,45 +49,43 @@ __cache_read_row_deleted(
 		upd->txnid = ref->txnid;
 	}
 
-	__wt_cache_page_inmem_incr(session, page,
-	    page->entries * (sizeof(WT_UPDATE *) + sizeof(WT_UPDATE)));
+	__wt_cache_page_inmem_incr(
+	    session, page, page->entries * sizeof(WT_UPDATE *));
 
 	return (0);
 }
 
 /*
- * __wt_cache_read --
- *	Read a page from the file.
+ * __cache_read --
+ *	Read a page from the file, our caller has set the reference's state.
  */
-int
-__wt_cache_read(WT_SESSION_IMPL *session, WT_PAGE *parent, WT_REF *ref)
+static int
+__cache_read(WT_SESSION_IMPL *session, WT_PAGE *parent,
+    WT_REF *ref, WT_PAGE_STATE previous_state, uint32_t page_flags)
 {
+	WT_BM *bm;
+	WT_BTREE *btree;
+	WT_BUF_POOL *pool;
 	WT_DECL_RET;
 	WT_ITEM tmp;
 	WT_PAGE *page;
-	WT_PAGE_STATE previous_state;
 	uint32_t size;
+	int found;
 	const uint8_t *addr;
 
+	btree = S2BT(session);
+	bm = btree->bm;
 	page = NULL;
 
 	/*
 	 * Don't pass an allocated buffer to the underlying block read function,
-	 * force allocation of new memory of the appropriate size.
+	 * force allocation of new memory of the appropriate size.  If there's
+	 * an I/O buffer pool, take the memory from the pool, the page's disk
+	 * image goes back to the pool when the page is discarded.
 	 */
 	WT_CLEAR(tmp);
-
-	/*
-	 * Attempt to set the state to WT_REF_READING for normal reads, or
-	 * WT_REF_LOCKED, for deleted pages.  If successful, we've won the
-	 * race, read the page.
-	 */
-	if (WT_ATOMIC_CAS(ref->state, WT_REF_DISK, WT_REF_READING))
-		previous_state = WT_REF_DISK;
-	else if (WT_ATOMIC_CAS(ref->state, WT_REF_DELETED, WT_REF_LOCKED))
-		previous_state = WT_REF_DELETED;
-	else
-		return (0);
+	if (S2C(session)->buf_pool != NULL)
+		F_SET(&tmp, WT_ITEM_ALIGNED);
 
 	/*
 	 * Get the address: if there is no address, the page was deleted, but a
@@ -100,8 +99,18 @@ __wt_cache_read(WT_SESSION_IMPL *session, WT_PAGE *parent, WT_REF *ref)
 
 		WT_ERR(__wt_btree_new_leaf_page(session, parent, ref, &page));
 	} else {
-		/* Read the backing disk page. */
-		WT_ERR(__wt_bt_read(session, &tmp, addr, size));
+		/*
+		 * Take the page image from the block cache if it's there, else
+		 * read the backing disk page.  Verify checks the blocks in the
+		 * file, don't give it cached images.
+		 */
+		found = 0;
+		if (S2C(session)->block_cache != NULL &&
+		    !F_ISSET(btree, WT_BTREE_VERIFY))
+			WT_ERR(bm->cache_get(
+			    bm, session, &tmp, addr, size, &found));
+		if (!found)
+			WT_ERR(__wt_bt_read(session, &tmp, addr, size));
 
 		/* Build the in-memory version of the page. */
 		WT_ERR(__wt_page_inmem(session, parent, ref, tmp.mem,
@@ -111,11 +120,27 @@ __wt_cache_read(WT_SESSION_IMPL *session, WT_PAGE *parent, WT_REF *ref)
 		/* If the page was deleted, instantiate that information. */
 		if (previous_state == WT_REF_DELETED)
 			WT_ERR(__cache_read_row_deleted(session, ref, page));
+
+		/*
+		 * Images from the block cache weren't allocated by the pool,
+		 * and images larger than the pool's largest size class are
+		 * allocated at their exact size.  Otherwise, remember the size
+		 * class of the memory, it goes back to the same free list.
+		 */
+		if ((pool = S2C(session)->buf_pool) != NULL &&
+		    !found && !F_ISSET(&tmp, WT_ITEM_MAPPED) &&
+		    tmp.memsize <= pool->unit * WT_BUF_POOL_CLASSES) {
+			F_SET_ATOMIC(page, WT_PAGE_DISK_POOL);
+			page->dsk_pool_class =
+			    (uint8_t)(tmp.memsize / pool->unit - 1);
+		}
 	}
 
 	WT_VERBOSE_ERR(session, read,
 	    "page %p: %s", page, __wt_page_type_string(page->type));
 
+	if (page_flags != 0)
+		F_SET_ATOMIC(page, page_flags);
 	WT_PUBLISH(ref->state, WT_REF_MEM);
 	return (0);
 
@@ -132,3 +157,42 @@ err:	WT_PUBLISH(ref->state, previous_state);
 
 	return (ret);
 }
+
+/*
+ * __wt_cache_read --
+ *	Read a page from the file.
+ */
+int
+__wt_cache_read(WT_SESSION_IMPL *session, WT_PAGE *parent, WT_REF *ref)
+{
+	WT_PAGE_STATE previous_state;
+
+	/*
+	 * Attempt to set the state to WT_REF_READING for normal reads, or
+	 * WT_REF_LOCKED, for deleted pages.  If successful, we've won the
+	 * race, read the page.
+	 */
+	if (WT_ATOMIC_CAS(ref->state, WT_REF_DISK, WT_REF_READING))
+		previous_state = WT_REF_DISK;
+	else if (WT_ATOMIC_CAS(ref->state, WT_REF_DELETED, WT_REF_LOCKED))
+		previous_state = WT_REF_DELETED;
+	else
+		return (0);
+
+	return (__cache_read(session, parent, ref, previous_state, 0));
+}
+
+/*
+ * __wt_cache_read_prefetch --
+ *	Read a page for a prefetch thread: the page was queued by setting its
+ * reference's state to WT_REF_READING, so the read is already ours.
+ */
+int
+__wt_cache_read_prefetch(
+    WT_SESSION_IMPL *session, WT_PAGE *parent, WT_REF *ref)
+{
+	WT_ASSERT(session, ref->state == WT_REF_READING);
+
+	return (__cache_read(
+	    session, parent, ref, WT_REF_DISK, WT_PAGE_PREFETCH));
+}
@@ -59,9 +59,22 @@ __wt_bt_cache_op(WT_SESSION_IMPL *session, WT_CKPT *ckptbase, int op)
 
 	switch (op) {
 	case WT_SYNC_CHECKPOINT:
-	case WT_SYNC_WRITE_LEAVES:
 		WT_ERR(__wt_sync_file(session, op));
 		break;
+	case WT_SYNC_WRITE_LEAVES:
+		/*
+		 * Flag the session so the block manager can throttle writes
+		 * done on behalf of checkpoints.  Only the pass writing leaf
+		 * pages before the checkpoint starts is throttled.  Once the
+		 * checkpoint starts, its snapshot keeps updates in the cache
+		 * and eviction is disabled in the tree while internal pages are
+		 * written, so that pass should finish quickly.
+		 */
+		F_SET(session, WT_SESSION_CHECKPOINT);
+		ret = __wt_sync_file(session, op);
+		F_CLR(session, WT_SESSION_CHECKPOINT);
+		WT_ERR(ret);
+		break;
 	case WT_SYNC_DISCARD:
 	case WT_SYNC_DISCARD_NOWRITE:
 		WT_ERR(__wt_evict_file(session, op));
@@ -152,6 +152,203 @@ __tree_walk_read(WT_SESSION_IMPL *session, WT_REF *ref, int *skipp)
 	return (0);
 }
 
+/*
+ * __tree_walk_preload --
+ *	Schedule a background read of a page that isn't in memory.  Returns
+ * EBUSY if no more reads can be scheduled.
+ */
+static int
+__tree_walk_preload(WT_SESSION_IMPL *session, WT_PAGE *page, WT_REF *ref)
+{
+	WT_BM *bm;
+	WT_DECL_RET;
+	uint32_t addr_size;
+	uint8_t addrbuf[WT_BTREE_MAX_ADDR_COOKIE];
+	const uint8_t *addr;
+
+	bm = S2BT(session)->bm;
+
+	/*
+	 * If there are prefetch threads, they read the page into the cache,
+	 * otherwise, ask the block manager to have the operating system read
+	 * it.
+	 */
+	if (S2C(session)->cache->pf_threads != 0) {
+		if ((ret = __wt_prefetch_queue(session, page, ref)) == 0) {
+			WT_STAT_FAST_CONN_INCR(session, cache_read_ahead);
+			WT_STAT_FAST_DATA_INCR(session, cache_read_ahead);
+		}
+		return (ret == WT_NOTFOUND ? 0 : ret);
+	}
+
+	/*
+	 * Lock the reference while copying its address: the address can't
+	 * change while the page is on disk, but another thread could read the
+	 * page, reconcile it and free the address out from under us.  Don't
+	 * wait, skipping a page only costs a later synchronous read.
+	 */
+	if (ref->state != WT_REF_DISK ||
+	    !WT_ATOMIC_CAS(ref->state, WT_REF_DISK, WT_REF_LOCKED))
+		return (0);
+	ret = __wt_ref_info(session, page, ref, &addr, &addr_size, NULL);
+	if (ret == 0 && addr != NULL)
+		memcpy(addrbuf, addr, addr_size);
+	else
+		addr_size = 0;
+	WT_PUBLISH(ref->state, WT_REF_DISK);
+	WT_RET(ret);
+
+	if (addr_size == 0)
+		return (0);
+	WT_RET(bm->preload(bm, session, addrbuf, addr_size));
+	WT_STAT_FAST_CONN_INCR(session, cache_read_ahead);
+	WT_STAT_FAST_DATA_INCR(session, cache_read_ahead);
+	return (0);
+}
+
+/*
+ * __tree_walk_read_ahead --
+ *	If a cursor walk is reading sibling pages from disk in order, schedule
+ *	reads of the siblings that follow.
+ */
+static int
+__tree_walk_read_ahead(
+    WT_SESSION_IMPL *session, WT_PAGE *page, uint32_t slot, int prev)
+{
+	WT_BTREE *btree;
+	WT_DECL_RET;
+	uint32_t end, i;
+
+	btree = S2BT(session);
+
+	/*
+	 * Read-ahead is adaptive: it starts when a walk has to read the sibling
+	 * immediately following the last page the walk visited, and the window
+	 * doubles each time that happens, up to the configured maximum.  Pages
+	 * already in memory (including pages read ahead) keep the window ahead
+	 * of the walk without growing it.  Visiting any other page resets the
+	 * window.  The parent page pointer is only compared, never followed,
+	 * so it doesn't matter if that page has since been evicted.
+	 */
+	if (session->read_ahead_page != page ||
+	    slot != (prev ? session->read_ahead_slot - 1 :
+	    session->read_ahead_slot + 1)) {
+		session->read_ahead_page = page;
+		session->read_ahead_slot = session->read_ahead_issued = slot;
+		session->read_ahead_window = 0;
+		return (0);
+	}
+	session->read_ahead_slot = slot;
+	if (page->u.intl.t[slot].state == WT_REF_DISK)
+		session->read_ahead_window = WT_MIN(btree->read_ahead,
+		    session->read_ahead_window == 0 ?
+		    2 : session->read_ahead_window * 2);
+	else if (session->read_ahead_window == 0)
+		return (0);
+
+	/*
+	 * Schedule reads of the siblings in the window we haven't already
+	 * scheduled, stopping if no more reads can be scheduled.
+	 */
+	if (prev) {
+		end = slot > session->read_ahead_window ?
+		    slot - session->read_ahead_window : 0;
+		for (i = WT_MIN(slot, session->read_ahead_issued);
+		    i > end; --i)
+			if ((ret = __tree_walk_preload(
+			    session, page, &page->u.intl.t[i - 1])) != 0)
+				break;
+	} else {
+		end = WT_MIN(page->entries - 1,
+		    slot + session->read_ahead_window);
+		for (i = WT_MAX(slot, session->read_ahead_issued);
+		    i < end; ++i)
+			if ((ret = __tree_walk_preload(
+			    session, page, &page->u.intl.t[i + 1])) != 0)
+				break;
+	}
+	session->read_ahead_issued = i;
+	return (ret == EBUSY ? 0 : ret);
+}
+
+/*
+ * __tree_walk_prefetch --
+ *	Queue a leaf page for the prefetch threads instead of reading it.
+ */
+static inline int
+__tree_walk_prefetch(
+    WT_SESSION_IMPL *session, WT_PAGE *page, WT_REF *ref, int *skipp)
+{
+	WT_DECL_RET;
+	uint32_t addr_size;
+	u_int type;
+	const uint8_t *addr;
+
+	*skipp = 0;
+	type = 0;				/* Keep compiler quiet. */
+
+	/*
+	 * Internal pages are read by the walk so it can find their children.
+	 * Lock the reference while checking its address: the address can't
+	 * change while the page is on disk, but another thread could read the
+	 * page, reconcile it and free the address out from under us.  If the
+	 * page is read by another thread after we unlock the reference,
+	 * queueing fails because the state has changed.
+	 */
+	if (ref->state != WT_REF_DISK ||
+	    !WT_ATOMIC_CAS(ref->state, WT_REF_DISK, WT_REF_LOCKED))
+		return (0);
+	ret = __wt_ref_info(session, page, ref, &addr, &addr_size, &type);
+	WT_PUBLISH(ref->state, WT_REF_DISK);
+	WT_RET(ret);
+	if (addr == NULL || type == WT_CELL_ADDR_INT)
+		return (0);
+
+	/*
+	 * Skip the page whether it's queued or not: if the queue is full, the
+	 * walk's caller notices and stops.
+	 */
+	*skipp = 1;
+	if ((ret = __wt_prefetch_queue(session, page, ref)) == EBUSY ||
+	    ret == WT_NOTFOUND)
+		ret = 0;
+	return (ret);
+}
+
+/*
+ * __tree_walk_compact_prefetch --
+ *	If there are prefetch threads, queue the siblings following a page
+ *	compaction has to read, if compaction will have to read them as well.
+ */
+static int
+__tree_walk_compact_prefetch(
+    WT_SESSION_IMPL *session, WT_PAGE *page, uint32_t slot, int prev)
+{
+	WT_DECL_RET;
+	WT_REF *ref;
+	u_int i;
+	int skip;
+
+	if (S2C(session)->cache->pf_threads == 0)
+		return (0);
+
+	for (i = 0; i < WT_PREFETCH_COMPACT; ++i) {
+		if (prev ? slot == 0 : slot == page->entries - 1)
+			break;
+		slot = prev ? slot - 1 : slot + 1;
+		ref = &page->u.intl.t[slot];
+		if (ref->state != WT_REF_DISK)
+			continue;
+		WT_RET(__wt_compact_page_skip(session, page, ref, &skip));
+		if (skip)
+			continue;
+		if ((ret = __wt_prefetch_queue(session, page, ref)) == EBUSY)
+			return (0);
+		WT_RET_NOTFOUND_OK(ret);
+	}
+	return (0);
+}
+
 /*
  * __wt_tree_walk --
  *	Move to the next/previous page in the tree.
@@ -163,7 +360,7 @@ __wt_tree_walk(WT_SESSION_IMPL *session, WT_PAGE **pagep, uint32_t flags)
 	WT_PAGE *couple, *page;
 	WT_REF *ref;
 	uint32_t slot;
-	int cache, compact, discard, eviction, prev, set_read_gen;
+	int cache, compact, discard, eviction, prefetch, prev, set_read_gen;
 	int skip, skip_intl, skip_leaf;
 
 	btree = S2BT(session);
@@ -174,6 +371,7 @@ __wt_tree_walk(WT_SESSION_IMPL *session, WT_PAGE **pagep, uint32_t flags)
 	compact = LF_ISSET(WT_TREE_COMPACT) ? 1 : 0;
 	eviction = LF_ISSET(WT_TREE_EVICT) ? 1 : 0;
 	cache = LF_ISSET(WT_TREE_CACHE) ? 1 : 0;
+	prefetch = LF_ISSET(WT_TREE_PREFETCH) ? 1 : 0;
 	prev = LF_ISSET(WT_TREE_PREV) ? 1 : 0;
 	skip_intl = LF_ISSET(WT_TREE_SKIP_INTL) ? 1 : 0;
 	skip_leaf = LF_ISSET(WT_TREE_SKIP_LEAF) ? 1 : 0;
@@ -397,6 +595,13 @@ retry:				if (ref->state != WT_REF_MEM ||
 					    session, page, ref, &skip));
 					if (skip)
 						break;
+
+					/*
+					 * Have any prefetch threads read the
+					 * pages compaction will want next.
+					 */
+					WT_RET(__tree_walk_compact_prefetch(
+					    session, page, slot, prev));
 				}
 				WT_RET(
 				    __wt_page_swap(session, couple, page, ref));
@@ -412,6 +617,20 @@ retry:				if (ref->state != WT_REF_MEM ||
 				if (skip)
 					break;
 
+				/*
+				 * If prefetching, queue leaf pages rather than
+				 * reading them, otherwise, optionally read
+				 * ahead of the cursor.
+				 */
+				if (prefetch) {
+					WT_RET(__tree_walk_prefetch(
+					    session, page, ref, &skip));
+					if (skip)
+						break;
+				} else if (btree->read_ahead != 0)
+					WT_RET(__tree_walk_read_ahead(
+					    session, page, slot, prev));
+
 				WT_RET(
 				    __wt_page_swap(session, couple, page, ref));
 			}
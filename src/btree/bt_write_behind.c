@@ -0,0 +1,385 @@
+/*-
+ * Copyright (c) 2008-2013 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+static int   __wb_file(WT_SESSION_IMPL *, uint64_t *);
+static void  __wb_next_file(WT_SESSION_IMPL *, WT_BTREE **);
+static void *__wb_server(void *);
+
+/*
+ * __wb_needed --
+ *	Return if there's enough dirty data in the cache for the write-behind
+ * threads to run: they start at half the eviction dirty target, so pages
+ * are written before eviction has to write them.
+ */
+static inline int
+__wb_needed(WT_CONNECTION_IMPL *conn)
+{
+	WT_CACHE *cache;
+
+	cache = conn->cache;
+	return (cache->bytes_dirty >
+	    (cache->eviction_dirty_target * conn->cache_size) / 200);
+}
+
+/*
+ * __wt_write_behind_create --
+ *	Start the write-behind threads.
+ */
+int
+__wt_write_behind_create(WT_CONNECTION_IMPL *conn, const char *cfg[])
+{
+	WT_CACHE *cache;
+	WT_CONFIG_ITEM cval;
+	WT_SESSION_IMPL *session;
+	u_int i, threads;
+
+	session = conn->default_session;
+	cache = conn->cache;
+
+	WT_RET(__wt_config_gets(session, cfg, "write_behind.threads", &cval));
+	threads = (u_int)cval.val;
+
+	/* If not configured, we're done. */
+	if (threads == 0)
+		return (0);
+
+	WT_RET(__wt_cond_alloc(
+	    session, "write-behind threads", 0, &cache->wb_cond));
+	WT_RET(__wt_calloc_def(
+	    session, WT_WRITE_BEHIND_MAX, &cache->wb_session));
+	WT_RET(__wt_calloc_def(session, WT_WRITE_BEHIND_MAX, &cache->wb_tid));
+
+	/* Each write-behind thread gets its own session. */
+	for (i = 0; i < threads; i++) {
+		WT_RET(__wt_open_session(
+		    conn, 1, NULL, NULL, &cache->wb_session[i]));
+		cache->wb_session[i]->name = "write-behind";
+	}
+
+	for (; cache->wb_threads < threads; ++cache->wb_threads)
+		WT_RET(__wt_thread_create(session,
+		    &cache->wb_tid[cache->wb_threads],
+		    __wb_server, cache->wb_session[cache->wb_threads]));
+
+	return (0);
+}
+
+/*
+ * __wt_write_behind_destroy --
+ *	Shut down the write-behind threads.
+ */
+int
+__wt_write_behind_destroy(WT_CONNECTION_IMPL *conn)
+{
+	WT_CACHE *cache;
+	WT_DECL_RET;
+	WT_SESSION *wt_session;
+	WT_SESSION_IMPL *session;
+	u_int i;
+
+	session = conn->default_session;
+	if ((cache = conn->cache) == NULL)
+		return (0);
+
+	if (cache->wb_threads != 0) {
+		WT_TRET(__wt_cond_signal(session, cache->wb_cond));
+		for (i = 0; i < cache->wb_threads; i++)
+			WT_TRET(__wt_thread_join(session, cache->wb_tid[i]));
+		cache->wb_threads = 0;
+	}
+
+	/*
+	 * Don't destroy the threads' condition variable: the eviction server
+	 * wakes the threads and is still running, the cache discards it.
+	 */
+
+	/* Close the threads' sessions. */
+	if (cache->wb_session != NULL)
+		for (i = 0; i < WT_WRITE_BEHIND_MAX; i++) {
+			if (cache->wb_session[i] == NULL)
+				break;
+			wt_session = &cache->wb_session[i]->iface;
+			WT_TRET(wt_session->close(wt_session, NULL));
+		}
+	__wt_free(session, cache->wb_session);
+	__wt_free(session, cache->wb_tid);
+
+	return (ret);
+}
+
+/*
+ * __wt_write_behind_wake --
+ *	Wake the write-behind threads if there's work for them to do.
+ */
+int
+__wt_write_behind_wake(WT_SESSION_IMPL *session)
+{
+	WT_CONNECTION_IMPL *conn;
+
+	conn = S2C(session);
+
+	if (conn->cache->wb_threads == 0 || !__wb_needed(conn))
+		return (0);
+	return (__wt_cond_signal(session, conn->cache->wb_cond));
+}
+
+/*
+ * __wb_server --
+ *	A write-behind thread.
+ */
+static void *
+__wb_server(void *arg)
+{
+	WT_BTREE *btree;
+	WT_CACHE *cache;
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+	WT_SESSION_IMPL *session;
+
+	session = arg;
+	conn = S2C(session);
+	cache = conn->cache;
+
+	/*
+	 * Write-behind threads only write what's visible to everyone, the same
+	 * as eviction, and their tree walks don't make pages look recently
+	 * used to eviction.
+	 */
+	session->txn.isolation = TXN_ISO_EVICTION;
+	F_SET(session, WT_SESSION_NO_CACHE);
+
+	while (F_ISSET(conn, WT_CONN_SERVER_RUN)) {
+		/*
+		 * Write files while there's enough dirty data, sleeping when
+		 * there's not, or there's no file we can write.
+		 */
+		btree = NULL;
+		if (__wb_needed(conn))
+			__wb_next_file(session, &btree);
+		if (btree == NULL) {
+			WT_ERR_TIMEDOUT_OK(
+			    __wt_cond_wait(session, cache->wb_cond, 100000));
+			continue;
+		}
+
+		__wt_txn_update_oldest(session);
+		WT_WITH_BTREE(session, btree, ret = __wb_file(session, NULL));
+		(void)WT_ATOMIC_SUB(btree->lru_count, 1);
+
+		/*
+		 * The file can't be written right now (for example, it's being
+		 * checkpointed), move on to the next one.
+		 */
+		if (ret == EBUSY)
+			ret = 0;
+		WT_ERR(ret);
+	}
+
+	if (0) {
+err:		__wt_err(session, ret, "write-behind thread error");
+	}
+	return (NULL);
+}
+
+/*
+ * __wt_write_behind_bytes --
+ *	Write dirty leaf pages until a number of bytes have been written, or
+ * each file has been visited once.  Used by the checkpoint server to spread
+ * writing dirty pages over the interval between checkpoints.
+ */
+int
+__wt_write_behind_bytes(WT_SESSION_IMPL *session, uint64_t bytes)
+{
+	WT_BTREE *btree;
+	WT_DECL_RET;
+	WT_TXN_ISOLATION saved_isolation;
+	u_int i;
+
+	/* Write what's visible to everyone, as the write-behind threads do. */
+	saved_isolation = session->txn.isolation;
+	session->txn.isolation = TXN_ISO_EVICTION;
+	F_SET(session, WT_SESSION_NO_CACHE);
+
+	__wt_txn_update_oldest(session);
+	for (i = 0; bytes > 0 && i < S2C(session)->open_btree_count; i++) {
+		__wb_next_file(session, &btree);
+		if (btree == NULL)
+			break;
+
+		WT_WITH_BTREE(session, btree, ret = __wb_file(session, &bytes));
+		(void)WT_ATOMIC_SUB(btree->lru_count, 1);
+
+		/* Skip files that can't be written right now. */
+		if (ret == EBUSY)
+			ret = 0;
+		WT_ERR(ret);
+	}
+
+err:	F_CLR(session, WT_SESSION_NO_CACHE);
+	session->txn.isolation = saved_isolation;
+	return (ret);
+}
+
+/*
+ * __wb_next_file --
+ *	Return the next file the write-behind threads should write.
+ */
+static void
+__wb_next_file(WT_SESSION_IMPL *session, WT_BTREE **btreep)
+{
+	WT_BTREE *btree;
+	WT_CACHE *cache;
+	WT_CONNECTION_IMPL *conn;
+	WT_DATA_HANDLE *dhandle, *start;
+
+	*btreep = NULL;
+
+	conn = S2C(session);
+	cache = conn->cache;
+
+	/*
+	 * Lock the dhandle list so sweeping cannot change the pointers out
+	 * from under us.
+	 */
+	__wt_spin_lock(session, &conn->dhandle_lock);
+
+	/*
+	 * Start at the handle after the last one written, or at the beginning
+	 * of the list if that handle is gone; like eviction, we only compare
+	 * the remembered handle's address, it may have been freed.
+	 */
+	SLIST_FOREACH(start, &conn->dhlh, l)
+		if (start == cache->wb_file_next)
+			break;
+	if (start == NULL)
+		start = SLIST_FIRST(&conn->dhlh);
+
+	for (dhandle = start; dhandle != NULL;) {
+		btree = dhandle->handle;
+
+		/*
+		 * Ignore non-file handles, handles that aren't open, checkpoint
+		 * handles (which are read-only), files without a root page and
+		 * files being bulk-loaded.
+		 */
+		if (WT_PREFIX_MATCH(dhandle->name, "file:") &&
+		    F_ISSET(dhandle, WT_DHANDLE_OPEN) &&
+		    dhandle->checkpoint == NULL &&
+		    btree->root_page != NULL && !btree->bulk_load_ok) {
+			/*
+			 * Use the LRU count to hold the file open: it's how
+			 * eviction holds files, closing a file sets the "no
+			 * eviction" flag under the walk lock, then waits for
+			 * the count to drain.
+			 */
+			__wt_spin_lock(session, &cache->evict_walk_lock);
+			if (!F_ISSET(btree, WT_BTREE_NO_EVICTION)) {
+				(void)WT_ATOMIC_ADD(btree->lru_count, 1);
+				*btreep = btree;
+			}
+			__wt_spin_unlock(session, &cache->evict_walk_lock);
+			if (*btreep != NULL)
+				break;
+		}
+
+		if ((dhandle = SLIST_NEXT(dhandle, l)) == NULL)
+			dhandle = SLIST_FIRST(&conn->dhlh);
+		if (dhandle == start)
+			dhandle = NULL;
+	}
+
+	/* Remember the file we should visit first, next time. */
+	cache->wb_file_next = dhandle == NULL ? NULL : SLIST_NEXT(dhandle, l);
+
+	__wt_spin_unlock(session, &conn->dhandle_lock);
+}
+
+/*
+ * __wb_file --
+ *	Write dirty leaf pages from a file until there's no longer enough dirty
+ * data in the cache, or, if a byte count is passed in, until that many bytes
+ * have been written.
+ */
+static int
+__wb_file(WT_SESSION_IMPL *session, uint64_t *bytesp)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+	WT_PAGE *page;
+	size_t size;
+	uint32_t flags;
+	u_int retries;
+	int written;
+
+	conn = S2C(session);
+	page = NULL;
+
+	/*
+	 * Walk the file's leaf pages in the cache, acquiring hazard pointers
+	 * to prevent eviction.
+	 */
+	flags = WT_TREE_CACHE | WT_TREE_SKIP_INTL;
+	WT_ERR(__wt_tree_walk(session, &page, flags));
+	while (page != NULL && F_ISSET(conn, WT_CONN_SERVER_RUN)) {
+		if (bytesp == NULL ? !__wb_needed(conn) : *bytesp == 0)
+			break;
+
+		if (__wt_page_is_modified(page)) {
+			/*
+			 * Pages written while holding a hazard pointer must not
+			 * be written by two threads at once: like the other
+			 * threads writing pages this way (checkpoints, LSM
+			 * flushes), hold the checkpoint lock.  Don't wait for
+			 * it, a checkpoint could hold it for a long time, and
+			 * closing a file can hold it while waiting for us.
+			 */
+			for (retries = 0; (ret = __wt_spin_trylock(
+			    session, &conn->checkpoint_lock)) == EBUSY &&
+			    ++retries < 100;)
+				__wt_yield();
+			WT_ERR(ret);
+
+			/* Write the page if nobody beat us to it. */
+			size = page->memory_footprint;
+			written = 0;
+			if (__wt_page_is_modified(page)) {
+				ret = __wt_rec_write(session, page, NULL, 0);
+				written = 1;
+			}
+			__wt_spin_unlock(session, &conn->checkpoint_lock);
+			WT_ERR(ret);
+
+			/*
+			 * The page may still be dirty if it had updates that
+			 * weren't yet visible to everyone.
+			 */
+			if (!written || __wt_page_is_modified(page))
+				;
+			else if (bytesp == NULL) {
+				WT_STAT_FAST_CONN_INCR(
+				    session, cache_write_behind);
+				WT_STAT_FAST_CONN_INCRV(session,
+				    cache_bytes_clean_write_behind, size);
+			} else {
+				*bytesp -= WT_MIN(*bytesp, size);
+				WT_STAT_FAST_CONN_INCR(
+				    session, txn_checkpoint_incremental_pages);
+				WT_STAT_FAST_CONN_INCRV(session,
+				    txn_checkpoint_incremental_bytes, size);
+			}
+		}
+
+		WT_ERR(__wt_tree_walk(session, &page, flags));
+	}
+
+err:	/* Release any page we're still holding. */
+	WT_TRET(__wt_page_release(session, page));
+
+	return (ret);
+}
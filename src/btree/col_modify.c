@@ -8,7 +8,7 @@
 #include "wt_internal.h"
 
 static int __col_insert_alloc(
-    WT_SESSION_IMPL *, uint64_t, u_int, WT_INSERT **, size_t *);
+    WT_SESSION_IMPL *, WT_PAGE *, uint64_t, u_int, WT_INSERT **, size_t *);
 
 /*
  * __wt_col_modify --
@@ -60,6 +60,7 @@ __wt_col_modify(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt, int is_remove)
 
 	ins = NULL;
 	upd = NULL;
+	ins_size = upd_size = 0;
 
 	/*
 	 * Delete, insert or update a column-store entry.
@@ -77,7 +78,8 @@ __wt_col_modify(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt, int is_remove)
 		WT_ERR(__wt_txn_update_check(session, old_upd = cbt->ins->upd));
 
 		/* Allocate the WT_UPDATE structure and transaction ID. */
-		WT_ERR(__wt_update_alloc(session, value, &upd, &upd_size));
+		WT_ERR(__wt_update_alloc(
+		    session, page, value, &upd, &upd_size));
 		WT_ERR(__wt_txn_modify(session, cbt, upd));
 		logged = 1;
 
@@ -119,10 +121,10 @@ __wt_col_modify(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt, int is_remove)
 		 * update the cursor to reference it.
 		 */
 		WT_ERR(__col_insert_alloc(
-		    session, recno, skipdepth, &ins, &ins_size));
-		WT_ERR(__wt_update_alloc(session, value, &upd, &upd_size));
+		    session, page, recno, skipdepth, &ins, &ins_size));
+		WT_ERR(__wt_update_alloc(
+		    session, page, value, &upd, &upd_size));
 		ins->upd = upd;
-		ins_size += upd_size;
 
 		/*
 		 * Update the cursor: the insert head may have been allocated,
@@ -159,11 +161,12 @@ __wt_col_modify(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt, int is_remove)
 		if (append)
 			WT_ERR(__wt_col_append_serial(
 			    session, page, cbt->ins_head, cbt->ins_stack,
-			    &ins, ins_size, &cbt->recno, skipdepth));
+			    &ins, ins_size, &upd, upd_size,
+			    &cbt->recno, skipdepth));
 		else
 			WT_ERR(__wt_insert_serial(
 			    session, page, cbt->ins_head, cbt->ins_stack,
-			    &ins, ins_size, skipdepth));
+			    &ins, ins_size, &upd, upd_size, skipdepth));
 	}
 
 	if (0) {
@@ -173,8 +176,8 @@ err:		/*
 		 */
 		if (logged)
 			__wt_txn_unmodify(session);
-		__wt_free(session, ins);
-		__wt_free(session, upd);
+		__wt_page_arena_free(session, page, ins, ins_size);
+		__wt_page_arena_free(session, page, upd, upd_size);
 	}
 
 	return (ret);
@@ -185,7 +188,7 @@ err:		/*
  *	Column-store insert: allocate a WT_INSERT structure and fill it in.
  */
 static int
-__col_insert_alloc(WT_SESSION_IMPL *session,
+__col_insert_alloc(WT_SESSION_IMPL *session, WT_PAGE *page,
     uint64_t recno, u_int skipdepth, WT_INSERT **insp, size_t *ins_sizep)
 {
 	WT_INSERT *ins;
@@ -196,7 +199,7 @@ __col_insert_alloc(WT_SESSION_IMPL *session,
 	 * the record number into place.
 	 */
 	ins_size = sizeof(WT_INSERT) + skipdepth * sizeof(WT_INSERT *);
-	WT_RET(__wt_calloc(session, 1, ins_size, &ins));
+	WT_RET(__wt_page_arena_alloc(session, page, ins_size, &ins));
 
 	WT_INSERT_RECNO(ins) = recno;
 
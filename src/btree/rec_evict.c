@@ -8,6 +8,8 @@
 #include "wt_internal.h"
 
 static int  __hazard_exclusive(WT_SESSION_IMPL *, WT_REF *, int);
+static int  __rec_image_detach(
+    WT_SESSION_IMPL *, WT_PAGE *, WT_REF *, uint8_t *, uint32_t *, void **);
 static void __rec_discard_tree(WT_SESSION_IMPL *, WT_PAGE *, int);
 static void __rec_excl_clear(WT_SESSION_IMPL *);
 static void __rec_page_clean_update(WT_SESSION_IMPL *, WT_REF *);
@@ -23,16 +25,21 @@ static void __rec_root_update(WT_SESSION_IMPL *);
 int
 __wt_rec_evict(WT_SESSION_IMPL *session, WT_PAGE *page, int exclusive)
 {
+	WT_BM *bm;
 	WT_DECL_RET;
 	WT_PAGE_MODIFY *mod;
 	WT_REF *parent_ref;
+	uint32_t addr_size;
 	int merge, inmem_split, istree;
+	uint8_t addr[WT_BTREE_MAX_ADDR_COOKIE];
+	void *image;
 
 	WT_VERBOSE_RET(session, evict,
 	    "page %p (%s)", page, __wt_page_type_string(page->type));
 
 	WT_ASSERT(session, session->excl_next == 0);
 	inmem_split = istree = 0;
+	image = NULL;
 
 	/*
 	 * If we get a split-merge page during normal eviction, try to collapse
@@ -97,6 +104,16 @@ __wt_rec_evict(WT_SESSION_IMPL *session, WT_PAGE *page, int exclusive)
 		WT_ASSERT(session,
 		    exclusive || parent_ref->state == WT_REF_LOCKED);
 
+		/*
+		 * If the page was never modified, its disk image is the block
+		 * the page was read from: keep it in the block cache.
+		 */
+		if (!exclusive && mod == NULL &&
+		    S2C(session)->block_cache != NULL &&
+		    !WT_PAGE_IS_ROOT(page))
+			WT_ERR(__rec_image_detach(session,
+			    page, parent_ref, addr, &addr_size, &image));
+
 		if (WT_PAGE_IS_ROOT(page))
 			__rec_root_update(session);
 		else
@@ -121,6 +138,16 @@ __wt_rec_evict(WT_SESSION_IMPL *session, WT_PAGE *page, int exclusive)
 	else
 		__wt_page_out(session, &page);
 
+	/*
+	 * Give any detached disk image to the block cache: the page has been
+	 * evicted, failing to cache the image doesn't fail the eviction.
+	 */
+	if (image != NULL) {
+		bm = S2BT(session)->bm;
+		(void)bm->cache_put(bm, session, image,
+		    ((WT_PAGE_HEADER *)image)->mem_size, addr, addr_size);
+	}
+
 	if (0) {
 err:		/*
 		 * If unable to evict this page, release exclusive reference(s)
@@ -136,6 +163,44 @@ done:	session->excl_next = 0;
 	return (ret);
 }
 
+/*
+ * __rec_image_detach --
+ *	Detach a clean page's disk image, so it isn't freed with the page, and
+ * copy the address of the block it was read from.
+ */
+static int
+__rec_image_detach(WT_SESSION_IMPL *session, WT_PAGE *page,
+    WT_REF *parent_ref, uint8_t *addr, uint32_t *addr_sizep, void **imagep)
+{
+	uint32_t size;
+	const uint8_t *p;
+
+	*imagep = NULL;
+
+	/* Mapped images aren't ours to keep. */
+	if (!F_ISSET_ATOMIC(page, WT_PAGE_DISK_ALLOC))
+		return (0);
+
+	/*
+	 * Copy the address: once the parent is updated, the parent page can
+	 * be evicted, and the address may reference its disk image.
+	 */
+	WT_RET(__wt_ref_info(
+	    session, page->parent, parent_ref, &p, &size, NULL));
+	if (p == NULL)
+		return (0);
+	memcpy(addr, p, size);
+	*addr_sizep = size;
+
+	/*
+	 * Leave the page referencing the image, it's needed while the page is
+	 * discarded, but don't let the discard free it.
+	 */
+	F_CLR_ATOMIC(page, WT_PAGE_DISK_ALLOC | WT_PAGE_DISK_POOL);
+	*imagep = page->dsk;
+	return (0);
+}
+
 /*
  * __rec_root_update --
  *	Update a root page's reference on eviction (clean or dirty).
@@ -490,6 +555,8 @@ ckpt:		WT_STAT_FAST_CONN_INCR(session, cache_eviction_checkpoint);
 		WT_RET(ret);
 
 		WT_ASSERT(session, !__wt_page_is_modified(page));
+		WT_STAT_FAST_CONN_INCRV(session,
+		    cache_bytes_clean_eviction, page->memory_footprint);
 	}
 
 	/*
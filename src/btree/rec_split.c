@@ -29,7 +29,6 @@ __split_row_page_inmem(WT_SESSION_IMPL *session, WT_PAGE *orig)
 	WT_REF *newref;
 	WT_UPDATE *next_upd;
 	int i, ins_depth;
-	size_t transfer_size;
 
 	new_parent = right_child = NULL;
 	new_ins_head_list = NULL;
@@ -102,6 +101,16 @@ __split_row_page_inmem(WT_SESSION_IMPL *session, WT_PAGE *orig)
 	WT_ERR(__wt_row_ikey_incr(session, new_parent, 0,
 	    WT_INSERT_KEY(ins), WT_INSERT_KEY_SIZE(ins), &newref->key.ikey));
 
+	/*
+	 * The item we're moving was allocated from the original page's arena:
+	 * the right child references the chunks holding it, they can't be freed
+	 * when the original page is discarded.
+	 */
+	WT_ERR(__wt_page_arena_share(session, orig, right_child, ins));
+	for (next_upd = ins->upd; next_upd != NULL; next_upd = next_upd->next)
+		WT_ERR(__wt_page_arena_share(
+		    session, orig, right_child, next_upd));
+
 	/*
 	 * Copy the first key from the original page into first ref in the new
 	 * parent.  Pages created in memory always have a "smallest" insert
@@ -139,18 +148,10 @@ __split_row_page_inmem(WT_SESSION_IMPL *session, WT_PAGE *orig)
 
 	/*
 	 * Now that all operations that could fail have completed, we start
-	 * updating the original page.
-	 */
-	transfer_size =
-	    ((size_t)(ins_depth - 1) * sizeof(WT_INSERT *)) +
-	    sizeof(WT_INSERT) + WT_INSERT_KEY_SIZE(ins) + ins->upd->size;
-	for (next_upd = ins->upd->next;
-	    next_upd != NULL; next_upd = next_upd->next)
-		transfer_size += next_upd->size;
-	__wt_cache_page_inmem_incr(session, right_child, transfer_size);
-	__wt_cache_page_inmem_decr(session, orig, transfer_size);
-
-	/*
+	 * updating the original page.  There's no footprint to transfer: the
+	 * right child was charged for the arena chunks it shares, and they
+	 * remain charged to the original page until it's discarded.
+	 *
 	 * Remove the entry from the orig page (i.e truncate the skip list).
 	 * Following is an example skip list that might help.
 	 *
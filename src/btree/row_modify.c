@@ -35,6 +35,7 @@ __wt_row_modify(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt, int is_remove)
 
 	ins = NULL;
 	upd = NULL;
+	ins_size = upd_size = 0;
 	logged = 0;
 
 	/*
@@ -61,7 +62,8 @@ __wt_row_modify(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt, int is_remove)
 		WT_ERR(__wt_txn_update_check(session, old_upd = *upd_entry));
 
 		/* Allocate the WT_UPDATE structure and transaction ID. */
-		WT_ERR(__wt_update_alloc(session, value, &upd, &upd_size));
+		WT_ERR(__wt_update_alloc(
+		    session, page, value, &upd, &upd_size));
 		WT_ERR(__wt_txn_modify(session, cbt, upd));
 		logged = 1;
 
@@ -105,11 +107,11 @@ __wt_row_modify(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt, int is_remove)
 		 * Allocate a WT_INSERT/WT_UPDATE pair and transaction ID, and
 		 * update the cursor to reference it.
 		 */
-		WT_ERR(__wt_row_insert_alloc(
-		    session, key, skipdepth, &ins, &ins_size));
-		WT_ERR(__wt_update_alloc(session, value, &upd, &upd_size));
+retry:		WT_ERR(__wt_row_insert_alloc(
+		    session, page, key, skipdepth, &ins, &ins_size));
+		WT_ERR(__wt_update_alloc(
+		    session, page, value, &upd, &upd_size));
 		ins->upd = upd;
-		ins_size += upd_size;
 
 		/*
 		 * Update the cursor: the WT_INSERT_HEAD might be allocated,
@@ -133,18 +135,52 @@ __wt_row_modify(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt, int is_remove)
 		 * writes before inserting them into the list.
 		 */
 		if (WT_SKIP_FIRST(ins_head) == NULL)
-			for (i = 0; i < skipdepth; i++) {
+			for (i = 0; i < WT_SKIP_MAXDEPTH; i++) {
 				cbt->ins_stack[i] = &ins_head->head[i];
-				ins->next[i] = cbt->next_stack[i] = NULL;
+				cbt->next_stack[i] = NULL;
+				if (i < skipdepth)
+					ins->next[i] = NULL;
 			}
 		else
 			for (i = 0; i < skipdepth; i++)
 				ins->next[i] = cbt->next_stack[i];
 
 		/* Insert the WT_INSERT structure. */
-		WT_ERR(__wt_insert_serial(
+		ret = __wt_insert_serial(
 		    session, page, cbt->ins_head, cbt->ins_stack,
-		    &ins, ins_size, skipdepth));
+		    &ins, ins_size, &upd, upd_size, skipdepth);
+
+		/*
+		 * If we raced with another thread inserting into the list, we
+		 * still hold the page: search the list again and retry rather
+		 * than searching the tree again.  (The insert and update were
+		 * freed by the serialization function.)  If the other thread
+		 * inserted our key, restart, this is an update now.
+		 */
+		if (ret == WT_RESTART) {
+			WT_STAT_FAST_CONN_INCR(session, cursor_insert_restart);
+			__wt_txn_unmodify(session);
+			logged = 0;
+			WT_ERR(__wt_search_insert(session, cbt, ins_head, key));
+			if (cbt->compare == 0 && cbt->ins != NULL)
+				WT_ERR(WT_RESTART);
+			goto retry;
+		}
+		WT_ERR(ret);
+
+		/*
+		 * Leave a finger at the new item for the cursor's next insert:
+		 * the item replaces its predecessor in the search stack at the
+		 * levels it's linked into, that is, where its predecessor still
+		 * references it.
+		 */
+		cbt->finger_id = page->modify->id;
+		cbt->finger_head = ins_head;
+		cbt->finger_ins = cbt->ins;
+		for (i = 0; i < WT_SKIP_MAXDEPTH; i++)
+			cbt->finger_stack[i] = i < skipdepth &&
+			    *cbt->ins_stack[i] == cbt->ins ?
+			    &cbt->ins->next[i] : cbt->ins_stack[i];
 	}
 
 	if (0) {
@@ -154,9 +190,9 @@ err:		/*
 		 */
 		if (logged)
 			__wt_txn_unmodify(session);
-		__wt_free(session, ins);
+		__wt_page_arena_free(session, page, ins, ins_size);
 		cbt->ins = NULL;
-		__wt_free(session, upd);
+		__wt_page_arena_free(session, page, upd, upd_size);
 	}
 
 	return (ret);
@@ -167,7 +203,7 @@ err:		/*
  *	Row-store insert: allocate a WT_INSERT structure and fill it in.
  */
 int
-__wt_row_insert_alloc(WT_SESSION_IMPL *session,
+__wt_row_insert_alloc(WT_SESSION_IMPL *session, WT_PAGE *page,
     WT_ITEM *key, u_int skipdepth, WT_INSERT **insp, size_t *ins_sizep)
 {
 	WT_INSERT *ins;
@@ -179,7 +215,7 @@ __wt_row_insert_alloc(WT_SESSION_IMPL *session,
 	 */
 	ins_size = sizeof(WT_INSERT) +
 	    skipdepth * sizeof(WT_INSERT *) + key->size;
-	WT_RET(__wt_calloc(session, 1, ins_size, &ins));
+	WT_RET(__wt_page_arena_alloc(session, page, ins_size, &ins));
 
 	ins->u.key.offset = WT_STORE_SIZE(ins_size - key->size);
 	WT_INSERT_KEY_SIZE(ins) = key->size;
@@ -197,7 +233,7 @@ __wt_row_insert_alloc(WT_SESSION_IMPL *session,
  */
 int
 __wt_update_alloc(WT_SESSION_IMPL *session,
-    WT_ITEM *value, WT_UPDATE **updp, size_t *sizep)
+    WT_PAGE *page, WT_ITEM *value, WT_UPDATE **updp, size_t *sizep)
 {
 	WT_UPDATE *upd;
 	size_t size;
@@ -207,7 +243,8 @@ __wt_update_alloc(WT_SESSION_IMPL *session,
 	 * the value into place.
 	 */
 	size = value == NULL ? 0 : value->size;
-	WT_RET(__wt_calloc(session, 1, sizeof(WT_UPDATE) + size, &upd));
+	WT_RET(__wt_page_arena_alloc(
+	    session, page, sizeof(WT_UPDATE) + size, &upd));
 	if (value == NULL)
 		WT_UPDATE_DELETED_SET(upd);
 	else {
@@ -267,19 +304,20 @@ __wt_update_obsolete_free(
     WT_SESSION_IMPL *session, WT_PAGE *page, WT_UPDATE *upd)
 {
 	WT_UPDATE *next;
-	size_t size;
+	size_t upd_size;
 
-	/* Free a WT_UPDATE list. */
-	for (size = 0; upd != NULL; upd = next) {
+	/*
+	 * Free a WT_UPDATE list.  The memory goes back to the page's arena and
+	 * remains part of the page's footprint.
+	 */
+	for (; upd != NULL; upd = next) {
 		/* Deleted items have a dummy size: don't include that. */
-		size += sizeof(WT_UPDATE) +
+		upd_size = sizeof(WT_UPDATE) +
 		    (WT_UPDATE_DELETED_ISSET(upd) ? 0 : upd->size);
 
 		next = upd->next;
-		__wt_free(session, upd);
+		__wt_page_arena_free(session, page, upd, upd_size);
 	}
-	if (size != 0)
-		__wt_cache_page_inmem_decr(session, page, size);
 }
 
 /*
@@ -7,6 +7,67 @@
 
 #include "wt_internal.h"
 
+/*
+ * __search_insert_finger --
+ *	Search a row-store insert list from the cursor's finger, for a key that
+ * sorts after the item the finger references.  Return WT_NOTFOUND if the key
+ * is too far from the finger, our caller searches from the top of the list.
+ */
+static inline int
+__search_insert_finger(
+    WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt, WT_ITEM *srch_key)
+{
+	WT_BTREE *btree;
+	WT_INSERT **insp, *last_ins, *ret_ins;
+	WT_ITEM insert_key;
+	u_int steps;
+	int cmp, i;
+
+	btree = S2BT(session);
+
+	/*
+	 * At each level, the finger's stack references the next pointer of an
+	 * item linked into that level and sorting before the search key (or
+	 * the list head): go forward from there to the item's predecessor at
+	 * that level.  Cursors inserting increasing keys take a few steps, if
+	 * other threads inserted many keys in between, give up.
+	 */
+	cmp = 1;
+	last_ins = ret_ins = NULL;
+	for (steps = 0, i = WT_SKIP_MAXDEPTH - 1; i >= 0; i--) {
+		for (insp = cbt->finger_stack[i];
+		    (ret_ins = *insp) != NULL; insp = &ret_ins->next[i]) {
+			/* Don't repeat comparisons as we drop down levels. */
+			if (ret_ins != last_ins) {
+				if (++steps > WT_SKIP_MAXDEPTH * 2)
+					return (WT_NOTFOUND);
+				last_ins = ret_ins;
+				insert_key.data = WT_INSERT_KEY(ret_ins);
+				insert_key.size = WT_INSERT_KEY_SIZE(ret_ins);
+				WT_RET(WT_LEX_CMP(session, btree->collator,
+				    srch_key, &insert_key, cmp));
+			}
+			if (cmp <= 0)
+				break;
+		}
+		if (ret_ins != NULL && cmp == 0) {
+			for (; i >= 0; i--) {
+				cbt->next_stack[i] = ret_ins->next[i];
+				cbt->ins_stack[i] = &ret_ins->next[i];
+			}
+			break;
+		}
+		cbt->next_stack[i] = ret_ins;
+		cbt->ins_stack[i] = insp;
+	}
+
+	WT_STAT_FAST_CONN_INCR(session, cursor_insert_finger);
+
+	cbt->compare = -cmp;
+	cbt->ins = ret_ins;
+	return (0);
+}
+
 /*
  * __wt_search_insert --
  *	Search a row-store insert list, creating a skiplist stack as we go.
@@ -16,8 +77,10 @@ __wt_search_insert(WT_SESSION_IMPL *session,
     WT_CURSOR_BTREE *cbt, WT_INSERT_HEAD *inshead, WT_ITEM *srch_key)
 {
 	WT_BTREE *btree;
+	WT_DECL_RET;
 	WT_INSERT **insp, *last_ins, *ret_ins;
 	WT_ITEM insert_key;
+	WT_PAGE *page;
 	uint32_t match, skiphigh, skiplow;
 	int cmp, i;
 
@@ -37,13 +100,10 @@ __wt_search_insert(WT_SESSION_IMPL *session,
 	    WT_LEX_CMP(session, btree->collator, srch_key, &insert_key, cmp));
 	if (cmp >= 0) {
 		/*
-		 * XXX We may race with another appending thread.
-		 *
-		 * To catch that case, rely on the atomic pointer read above
-		 * and set the next stack to NULL here.  If we have raced with
-		 * another thread, one of the next pointers will not be NULL by
-		 * the time they are checked against the next stack inside the
-		 * serialized insert function.
+		 * Set the next stack to NULL: another thread may append at the
+		 * same time, the insert function detects that and moves the
+		 * item to the new end of the list, see the concurrent insert
+		 * protocol described with WT_INSERT_HEAD in btmem.h.
 		 */
 		for (i = WT_SKIP_MAXDEPTH - 1; i >= 0; i--) {
 			cbt->ins_stack[i] = (i == 0) ? &ret_ins->next[0] :
@@ -56,6 +116,27 @@ __wt_search_insert(WT_SESSION_IMPL *session,
 		return (0);
 	}
 
+	/*
+	 * If the cursor left a finger in this insert list, and the search key
+	 * sorts after the item it references, start there.  The finger is only
+	 * valid if the page is the one the cursor inserted into: check the
+	 * page's modify ID, its memory may have been reused.  An in-memory
+	 * split moves the last item in the list to another page, don't use
+	 * fingers on pages that have split.
+	 */
+	page = cbt->page;
+	if (cbt->finger_head == inshead && page->modify != NULL &&
+	    page->modify->id == cbt->finger_id &&
+	    !F_ISSET_ATOMIC(page, WT_PAGE_WAS_SPLIT)) {
+		insert_key.data = WT_INSERT_KEY(cbt->finger_ins);
+		insert_key.size = WT_INSERT_KEY_SIZE(cbt->finger_ins);
+		WT_RET(WT_LEX_CMP(
+		    session, btree->collator, srch_key, &insert_key, cmp));
+		if (cmp > 0 && (ret = __search_insert_finger(
+		    session, cbt, srch_key)) != WT_NOTFOUND)
+			return (ret);
+	}
+
 	/*
 	 * The insert list is a skip list: start at the highest skip level, then
 	 * go as far as possible at each level before stepping down to the next.
@@ -107,6 +188,88 @@ __wt_search_insert(WT_SESSION_IMPL *session,
 	return (0);
 }
 
+/*
+ * __leaf_hash_build --
+ *	Build a hash index for a row-store leaf page.
+ */
+static int
+__leaf_hash_build(WT_SESSION_IMPL *session, WT_PAGE *page)
+{
+	WT_DECL_ITEM(tmp);
+	WT_DECL_RET;
+	WT_ROW *rip;
+	WT_ROW_HASH *hash;
+	size_t size;
+	uint64_t h;
+	uint32_t buckets, i, j;
+
+	hash = NULL;
+
+	/* Keep the table at most half full, probe sequences stay short. */
+	buckets = __wt_nlpo2(page->entries * 2);
+	size = sizeof(WT_ROW_HASH) + buckets * sizeof(uint64_t);
+	WT_RET(__wt_calloc(session, 1, size, &hash));
+	hash->mask = buckets - 1;
+	hash->bucket = (uint64_t *)(hash + 1);
+
+	/*
+	 * Don't instantiate the keys: most are never searched for, and the
+	 * search instantiates the ones that are.
+	 */
+	WT_ERR(__wt_scr_alloc(session, 0, &tmp));
+	WT_ROW_FOREACH(page, rip, i) {
+		WT_ERR(__wt_row_leaf_key(session, page, rip, tmp, 0));
+		h = __wt_hash_city64(tmp->data, tmp->size);
+		for (j = (uint32_t)h & hash->mask;
+		    hash->bucket[j] != 0; j = (j + 1) & hash->mask)
+			;
+		hash->bucket[j] =
+		    (h & 0xffffffff00000000ULL) | (WT_ROW_SLOT(page, rip) + 1);
+	}
+
+	/* Leaf WT_ROW arrays don't change, threads racing can give up. */
+	if (WT_ATOMIC_CAS(page->u.row.srch_hash, NULL, hash)) {
+		__wt_cache_page_inmem_incr(session, page, size);
+		WT_STAT_FAST_CONN_INCR(session, cache_leaf_hash);
+		hash = NULL;
+	}
+
+err:	__wt_scr_free(&tmp);
+	__wt_free(session, hash);
+	return (ret);
+}
+
+/*
+ * __leaf_hash_search --
+ *	Search a row-store leaf page's hash index for a key, returning the
+ * matching WT_ROW slot, or NULL if the key isn't in the page's WT_ROW array.
+ */
+static inline int
+__leaf_hash_search(WT_SESSION_IMPL *session, WT_PAGE *page,
+    WT_ROW_HASH *hash, WT_ITEM *srch_key, WT_ITEM *item, WT_ROW **ripp)
+{
+	WT_ROW *rip;
+	uint64_t bucket, h;
+	uint32_t j;
+
+	*ripp = NULL;
+
+	h = __wt_hash_city64(srch_key->data, srch_key->size);
+	for (j = (uint32_t)h & hash->mask;
+	    (bucket = hash->bucket[j]) != 0; j = (j + 1) & hash->mask) {
+		if ((bucket ^ h) >> 32 != 0)
+			continue;
+		rip = page->u.row.d + (uint32_t)bucket - 1;
+		WT_RET(__wt_row_leaf_key(session, page, rip, item, 1));
+		if (item->size == srch_key->size &&
+		    memcmp(item->data, srch_key->data, item->size) == 0) {
+			*ripp = rip;
+			break;
+		}
+	}
+	return (0);
+}
+
 /*
  * __wt_row_search --
  *	Search a row-store tree for a specific key.
@@ -120,6 +283,7 @@ __wt_row_search(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt)
 	WT_PAGE *page;
 	WT_REF *ref;
 	WT_ROW *rip;
+	WT_ROW_HASH *hash;
 	uint32_t base, indx, limit, match, skiphigh, skiplow;
 	int cmp, depth;
 
@@ -229,12 +393,35 @@ descend:	WT_ASSERT(session, ref != NULL);
 	if (depth > btree->maximum_depth)
 		btree->maximum_depth = depth;
 
+	/*
+	 * If the page has a hash index, check it for an exact match in the
+	 * page's WT_ROW array, the binary search finds anything else.  Build
+	 * the index once the page is hot.  A match skips the binary search, so
+	 * set its starting point first.
+	 */
+	base = 0;
+	if (btree->leaf_hash_index && page->entries > WT_ROW_HASH_MIN) {
+		if ((hash = page->u.row.srch_hash) == NULL &&
+		    ++page->u.row.srch_count > WT_ROW_HASH_HOT) {
+			WT_ERR(__leaf_hash_build(session, page));
+			hash = page->u.row.srch_hash;
+		}
+		if (hash != NULL) {
+			WT_ERR(__leaf_hash_search(
+			    session, page, hash, srch_key, item, &rip));
+			if (rip != NULL) {
+				cmp = 0;
+				goto done;
+			}
+		}
+	}
+
 	/*
 	 * Do a binary search of the leaf page; the page might be empty, reset
 	 * the comparison value.
 	 */
 	cmp = -1;
-	for (base = 0, limit = page->entries; limit != 0; limit >>= 1) {
+	for (limit = page->entries; limit != 0; limit >>= 1) {
 		indx = base + (limit >> 1);
 		rip = page->u.row.d + indx;
 
@@ -259,7 +446,7 @@ descend:	WT_ASSERT(session, ref != NULL);
 	 * performance problem if it does).  Trust, but verify, and complain if
 	 * there's a problem.
 	 */
-	if (item->mem != NULL) {
+done:	if (item->mem != NULL) {
 		static int complain = 1;
 		if (complain) {
 			__wt_errx(session,
@@ -23,6 +23,13 @@ static const WT_CONFIG_CHECK confchk_connection_open_session[] = {
 	{ NULL, NULL, NULL, NULL }
 };
 
+static const WT_CONFIG_CHECK confchk_eviction_subconfigs[] = {
+	{ "scan_resistant", "boolean", NULL, NULL },
+	{ "threads_max", "int", "min=1,max=20", NULL },
+	{ "threads_min", "int", "min=1,max=20", NULL },
+	{ NULL, NULL, NULL, NULL }
+};
+
 static const WT_CONFIG_CHECK confchk_shared_cache_subconfigs[] = {
 	{ "chunk", "int", "min=1MB,max=10TB", NULL },
 	{ "enable", "boolean", NULL, NULL },
@@ -35,6 +42,7 @@ static const WT_CONFIG_CHECK confchk_shared_cache_subconfigs[] = {
 static const WT_CONFIG_CHECK confchk_connection_reconfigure[] = {
 	{ "cache_size", "int", "min=1MB,max=10TB", NULL},
 	{ "error_prefix", "string", NULL, NULL},
+	{ "eviction", "category", NULL, confchk_eviction_subconfigs},
 	{ "eviction_dirty_target", "int", "min=10,max=99", NULL},
 	{ "eviction_target", "int", "min=10,max=99", NULL},
 	{ "eviction_trigger", "int", "min=10,max=99", NULL},
@@ -76,6 +84,7 @@ static const WT_CONFIG_CHECK confchk_file_meta[] = {
 	{ "internal_page_max", "int", "min=512B,max=512MB", NULL},
 	{ "key_format", "format", NULL, NULL},
 	{ "key_gap", "int", "min=0", NULL},
+	{ "leaf_hash_index", "boolean", NULL, NULL},
 	{ "leaf_item_max", "int", "min=0", NULL},
 	{ "leaf_page_max", "int", "min=512B,max=512MB", NULL},
 	{ "memory_page_max", "int", "min=512B,max=10TB", NULL},
@@ -83,6 +92,7 @@ static const WT_CONFIG_CHECK confchk_file_meta[] = {
 	{ "os_cache_max", "int", "min=0", NULL},
 	{ "prefix_compression", "boolean", NULL, NULL},
 	{ "prefix_compression_min", "int", "min=0", NULL},
+	{ "read_ahead", "int", "min=0,max=1024", NULL},
 	{ "split_pct", "int", "min=25,max=100", NULL},
 	{ "value_format", "format", NULL, NULL},
 	{ "version", "string", NULL, NULL},
@@ -157,6 +167,7 @@ static const WT_CONFIG_CHECK confchk_session_create[] = {
 	{ "internal_page_max", "int", "min=512B,max=512MB", NULL},
 	{ "key_format", "format", NULL, NULL},
 	{ "key_gap", "int", "min=0", NULL},
+	{ "leaf_hash_index", "boolean", NULL, NULL},
 	{ "leaf_item_max", "int", "min=0", NULL},
 	{ "leaf_page_max", "int", "min=512B,max=512MB", NULL},
 	{ "lsm", "category", NULL, confchk_lsm_subconfigs},
@@ -165,6 +176,7 @@ static const WT_CONFIG_CHECK confchk_session_create[] = {
 	{ "os_cache_max", "int", "min=0", NULL},
 	{ "prefix_compression", "boolean", NULL, NULL},
 	{ "prefix_compression_min", "int", "min=0", NULL},
+	{ "read_ahead", "int", "min=0,max=1024", NULL},
 	{ "source", "string", NULL, NULL},
 	{ "split_pct", "int", "min=25,max=100", NULL},
 	{ "type", "string", NULL, NULL},
@@ -186,6 +198,7 @@ static const WT_CONFIG_CHECK confchk_session_open_cursor[] = {
 	{ "next_random", "boolean", NULL, NULL},
 	{ "overwrite", "boolean", NULL, NULL},
 	{ "raw", "boolean", NULL, NULL},
+	{ "scan", "boolean", NULL, NULL},
 	{ "statistics", "list",
 	    "choices=[\"all\",\"fast\",\"clear\"]",
 	    NULL},
@@ -220,17 +233,45 @@ static const WT_CONFIG_CHECK confchk_table_meta[] = {
 	{ NULL, NULL, NULL, NULL }
 };
 
+static const WT_CONFIG_CHECK confchk_async_io_subconfigs[] = {
+	{ "enabled", "boolean", NULL, NULL },
+	{ "queue_depth", "int", "min=1,max=1024", NULL },
+	{ NULL, NULL, NULL, NULL }
+};
+
+static const WT_CONFIG_CHECK confchk_block_cache_subconfigs[] = {
+	{ "size", "int", "min=0,max=10TB", NULL },
+	{ NULL, NULL, NULL, NULL }
+};
+
+static const WT_CONFIG_CHECK confchk_buffer_pool_subconfigs[] = {
+	{ "size", "int", "min=0,max=10TB", NULL },
+	{ NULL, NULL, NULL, NULL }
+};
+
 static const WT_CONFIG_CHECK confchk_checkpoint_subconfigs[] = {
+	{ "incremental", "boolean", NULL, NULL },
+	{ "max_mb_per_sec", "int", "min=0", NULL },
 	{ "name", "string", NULL, NULL },
+	{ "threads", "int", "min=0,max=8", NULL },
 	{ "wait", "int", "min=1,max=100000", NULL },
 	{ NULL, NULL, NULL, NULL }
 };
 
 static const WT_CONFIG_CHECK confchk_log_subconfigs[] = {
 	{ "archive", "boolean", NULL, NULL },
+	{ "compressor", "string", NULL, NULL },
 	{ "enabled", "boolean", NULL, NULL },
 	{ "file_max", "int", "min=100KB,max=2GB", NULL },
+	{ "group_commit_usecs", "int", "min=0,max=1000000", NULL },
 	{ "path", "string", NULL, NULL },
+	{ "prealloc", "int", "min=0,max=16", NULL },
+	{ "recovery_threads", "int", "min=0,max=8", NULL },
+	{ NULL, NULL, NULL, NULL }
+};
+
+static const WT_CONFIG_CHECK confchk_prefetch_subconfigs[] = {
+	{ "threads", "int", "min=0,max=8", NULL },
 	{ NULL, NULL, NULL, NULL }
 };
 
@@ -242,8 +283,18 @@ static const WT_CONFIG_CHECK confchk_statistics_log_subconfigs[] = {
 	{ NULL, NULL, NULL, NULL }
 };
 
+static const WT_CONFIG_CHECK confchk_write_behind_subconfigs[] = {
+	{ "threads", "int", "min=0,max=8", NULL },
+	{ NULL, NULL, NULL, NULL }
+};
+
 static const WT_CONFIG_CHECK confchk_wiredtiger_open[] = {
+	{ "async_io", "category", NULL, confchk_async_io_subconfigs},
+	{ "block_cache", "category", NULL,
+	     confchk_block_cache_subconfigs},
 	{ "buffer_alignment", "int", "min=-1,max=1MB", NULL},
+	{ "buffer_pool", "category", NULL,
+	     confchk_buffer_pool_subconfigs},
 	{ "cache_size", "int", "min=1MB,max=10TB", NULL},
 	{ "checkpoint", "category", NULL, confchk_checkpoint_subconfigs}
 	    ,
@@ -251,6 +302,7 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open[] = {
 	{ "create", "boolean", NULL, NULL},
 	{ "direct_io", "list", "choices=[\"data\",\"log\"]", NULL},
 	{ "error_prefix", "string", NULL, NULL},
+	{ "eviction", "category", NULL, confchk_eviction_subconfigs},
 	{ "eviction_dirty_target", "int", "min=10,max=99", NULL},
 	{ "eviction_target", "int", "min=10,max=99", NULL},
 	{ "eviction_trigger", "int", "min=10,max=99", NULL},
@@ -261,6 +313,7 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open[] = {
 	{ "lsm_merge", "boolean", NULL, NULL},
 	{ "mmap", "boolean", NULL, NULL},
 	{ "multiprocess", "boolean", NULL, NULL},
+	{ "prefetch", "category", NULL, confchk_prefetch_subconfigs},
 	{ "session_max", "int", "min=1", NULL},
 	{ "shared_cache", "category", NULL,
 	     confchk_shared_cache_subconfigs},
@@ -279,6 +332,8 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open[] = {
 	    ",\"overflow\",\"read\",\"readserver\",\"reconcile\",\"recovery\""
 	    ",\"salvage\",\"shared_cache\",\"verify\",\"version\",\"write\"]",
 	    NULL},
+	{ "write_behind", "category", NULL,
+	     confchk_write_behind_subconfigs},
 	{ NULL, NULL, NULL, NULL }
 };
 
@@ -317,7 +372,8 @@ static const WT_CONFIG_ENTRY config_entries[] = {
 	  confchk_connection_open_session
 	},
 	{ "connection.reconfigure",
-	  "cache_size=100MB,error_prefix=,eviction_dirty_target=80,"
+	  "cache_size=100MB,error_prefix=,eviction=(scan_resistant=0,"
+	  "threads_max=1,threads_min=1),eviction_dirty_target=80,"
 	  "eviction_target=80,eviction_trigger=95,shared_cache=(chunk=10MB,"
 	  "enable=0,name=pool,reserve=0,size=500MB),statistics=none,"
 	  "verbose=",
@@ -333,10 +389,10 @@ static const WT_CONFIG_ENTRY config_entries[] = {
 	  "checksum=uncompressed,collator=,columns=,dictionary=0,"
 	  "format=btree,huffman_key=,huffman_value=,id=,internal_item_max=0"
 	  ",internal_key_truncate=,internal_page_max=4KB,key_format=u,"
-	  "key_gap=10,leaf_item_max=0,leaf_page_max=1MB,memory_page_max=5MB"
-	  ",os_cache_dirty_max=0,os_cache_max=0,prefix_compression=,"
-	  "prefix_compression_min=4,split_pct=75,value_format=u,"
-	  "version=(major=0,minor=0)",
+	  "key_gap=10,leaf_hash_index=0,leaf_item_max=0,leaf_page_max=1MB,"
+	  "memory_page_max=5MB,os_cache_dirty_max=0,os_cache_max=0,"
+	  "prefix_compression=,prefix_compression_min=4,read_ahead=0,"
+	  "split_pct=75,value_format=u,version=(major=0,minor=0)",
 	  confchk_file_meta
 	},
 	{ "index.meta",
@@ -368,13 +424,13 @@ static const WT_CONFIG_ENTRY config_entries[] = {
 	  "cache_resident=0,checksum=uncompressed,colgroups=,collator=,"
 	  "columns=,dictionary=0,exclusive=0,format=btree,huffman_key=,"
 	  "huffman_value=,internal_item_max=0,internal_key_truncate=,"
-	  "internal_page_max=4KB,key_format=u,key_gap=10,leaf_item_max=0,"
-	  "leaf_page_max=1MB,lsm=(auto_throttle=,bloom=,bloom_bit_count=16,"
-	  "bloom_config=,bloom_hash_count=8,bloom_oldest=0,chunk_max=5GB,"
-	  "chunk_size=10MB,merge_max=15,merge_threads=1),"
-	  "memory_page_max=5MB,os_cache_dirty_max=0,os_cache_max=0,"
-	  "prefix_compression=,prefix_compression_min=4,source=,"
-	  "split_pct=75,type=file,value_format=u",
+	  "internal_page_max=4KB,key_format=u,key_gap=10,leaf_hash_index=0,"
+	  "leaf_item_max=0,leaf_page_max=1MB,lsm=(auto_throttle=,bloom=,"
+	  "bloom_bit_count=16,bloom_config=,bloom_hash_count=8,"
+	  "bloom_oldest=0,chunk_max=5GB,chunk_size=10MB,merge_max=15,"
+	  "merge_threads=1),memory_page_max=5MB,os_cache_dirty_max=0,"
+	  "os_cache_max=0,prefix_compression=,prefix_compression_min=4,"
+	  "read_ahead=0,source=,split_pct=75,type=file,value_format=u",
 	  confchk_session_create
 	},
 	{ "session.drop",
@@ -387,9 +443,13 @@ static const WT_CONFIG_ENTRY config_entries[] = {
 	},
 	{ "session.open_cursor",
 	  "append=0,bulk=0,checkpoint=,dump=,next_random=0,overwrite=,raw=0"
-	  ",statistics=,target=",
+	  ",scan=0,statistics=,target=",
 	  confchk_session_open_cursor
 	},
+	{ "session.prefetch",
+	  "",
+	  NULL
+	},
 	{ "session.reconfigure",
 	  "isolation=read-committed",
 	  confchk_session_reconfigure
@@ -423,17 +483,21 @@ static const WT_CONFIG_ENTRY config_entries[] = {
 	  confchk_table_meta
 	},
 	{ "wiredtiger_open",
-	  "buffer_alignment=-1,cache_size=100MB,"
-	  "checkpoint=(name=\"WiredTigerCheckpoint\",wait=0),"
-	  "checkpoint_sync=,create=0,direct_io=,error_prefix=,"
-	  "eviction_dirty_target=80,eviction_target=80,eviction_trigger=95,"
-	  "extensions=,file_extend=,hazard_max=1000,log=(archive=,enabled=0"
-	  ",file_max=100MB,path=\"\"),lsm_merge=,mmap=,multiprocess=0,"
-	  "session_max=50,shared_cache=(chunk=10MB,enable=0,name=pool,"
-	  "reserve=0,size=500MB),statistics=none,"
+	  "async_io=(enabled=0,queue_depth=32),block_cache=(size=0),"
+	  "buffer_alignment=-1,buffer_pool=(size=0),cache_size=100MB,"
+	  "checkpoint=(incremental=0,max_mb_per_sec=0,"
+	  "name=\"WiredTigerCheckpoint\",threads=0,wait=0),checkpoint_sync="
+	  ",create=0,direct_io=,error_prefix=,eviction=(scan_resistant=0,"
+	  "threads_max=1,threads_min=1),eviction_dirty_target=80,"
+	  "eviction_target=80,eviction_trigger=95,extensions=,file_extend=,"
+	  "hazard_max=1000,log=(archive=,compressor=,enabled=0,"
+	  "file_max=100MB,group_commit_usecs=0,path=\"\",prealloc=0,"
+	  "recovery_threads=0),lsm_merge=,mmap=,multiprocess=0,"
+	  "prefetch=(threads=0),session_max=50,shared_cache=(chunk=10MB,"
+	  "enable=0,name=pool,reserve=0,size=500MB),statistics=none,"
 	  "statistics_log=(path=\"WiredTigerStat.%H\",sources=,"
 	  "timestamp=\"%b %d %H:%M:%S\",wait=0),transaction_sync=dsync,"
-	  "use_environment_priv=0,verbose=",
+	  "use_environment_priv=0,verbose=,write_behind=(threads=0)",
 	  confchk_wiredtiger_open
 	},
 	{ NULL, NULL, NULL }
@@ -545,6 +545,7 @@ __conn_reconfigure(WT_CONNECTION *wt_conn, const char *config)
 
 	WT_ERR(__wt_conn_cache_pool_config(session, cfg));
 	WT_ERR(__wt_cache_config(conn, raw_cfg));
+	WT_ERR(__wt_evict_workers_open(conn));
 
 	WT_ERR(__conn_statistics_config(session, raw_cfg));
 	WT_ERR(__conn_verbose_config(session, raw_cfg));
@@ -1113,6 +1114,17 @@ wiredtiger_open(const char *home, WT_EVENT_HANDLER *event_handler,
 
 	WT_ERR(__wt_conn_cache_pool_config(session, cfg));
 
+	WT_ERR(__wt_config_gets(session, cfg, "async_io.enabled", &cval));
+	if (cval.val) {
+#ifndef HAVE_LINUX_AIO
+		WT_ERR_MSG(session, EINVAL,
+		    "async_io requires Linux native AIO");
+#endif
+		WT_ERR(__wt_config_gets(
+		    session, cfg, "async_io.queue_depth", &cval));
+		conn->aio_depth = (u_int)cval.val;
+	}
+
 	WT_ERR(__wt_config_gets(session, cfg, "buffer_alignment", &cval));
 	if (cval.val == -1)
 		conn->buffer_alignment = WT_BUFFER_ALIGNMENT_DEFAULT;
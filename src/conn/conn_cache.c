@@ -18,6 +18,7 @@ __wt_cache_config(WT_CONNECTION_IMPL *conn, const char *cfg[])
 	WT_CONFIG_ITEM cval;
 	WT_DECL_RET;
 	WT_SESSION_IMPL *session;
+	u_int evict_workers_max, evict_workers_min;
 
 	session = conn->default_session;
 	cache = conn->cache;
@@ -54,6 +55,32 @@ __wt_cache_config(WT_CONNECTION_IMPL *conn, const char *cfg[])
 		cache->eviction_dirty_target = (u_int)cval.val;
 	WT_RET_NOTFOUND_OK(ret);
 
+	if ((ret = __wt_config_gets(
+	    session, cfg, "eviction.scan_resistant", &cval)) == 0)
+		cache->eviction_scan_resistant = cval.val == 0 ? 0 : 1;
+	WT_RET_NOTFOUND_OK(ret);
+
+	/*
+	 * The eviction thread counts include the eviction server, we track the
+	 * number of additional worker threads.
+	 */
+	evict_workers_max = cache->evict_workers_max;
+	evict_workers_min = cache->evict_workers_min;
+	if ((ret = __wt_config_gets(
+	    session, cfg, "eviction.threads_max", &cval)) == 0)
+		evict_workers_max = (u_int)cval.val - 1;
+	WT_RET_NOTFOUND_OK(ret);
+	if ((ret = __wt_config_gets(
+	    session, cfg, "eviction.threads_min", &cval)) == 0)
+		evict_workers_min = (u_int)cval.val - 1;
+	WT_RET_NOTFOUND_OK(ret);
+	if (evict_workers_min > evict_workers_max)
+		WT_RET_MSG(session, EINVAL,
+		    "eviction=(threads_min) must not be larger than "
+		    "eviction=(threads_max)");
+	cache->evict_workers_max = evict_workers_max;
+	cache->evict_workers_min = evict_workers_min;
+
 	return (0);
 }
 
@@ -77,6 +104,10 @@ __wt_cache_create(WT_CONNECTION_IMPL *conn, const char *cfg[])
 
 	cache = conn->cache;
 
+	/* Allocate the eviction worker contexts. */
+	WT_RET(__wt_calloc_def(
+	    session, WT_EVICT_MAX_WORKERS, &cache->evict_workctx));
+
 	/* Use a common routine for run-time configuration options. */
 	WT_RET(__wt_cache_config(conn, cfg));
 
@@ -124,6 +155,9 @@ __wt_cache_stats_update(WT_SESSION_IMPL *session)
 	WT_CACHE *cache;
 	WT_CONNECTION_IMPL *conn;
 	WT_CONNECTION_STATS *stats;
+	WT_EVICT_WORKER *worker;
+	uint64_t evicted_max, evicted_min;
+	u_int i;
 
 	conn = S2C(session);
 	cache = conn->cache;
@@ -134,6 +168,27 @@ __wt_cache_stats_update(WT_SESSION_IMPL *session)
 	WT_STAT_SET(stats, cache_pages_inuse, __wt_cache_pages_inuse(cache));
 	WT_STAT_SET(stats, cache_bytes_dirty, cache->bytes_dirty);
 	WT_STAT_SET(stats, cache_pages_dirty, cache->pages_dirty);
+	WT_STAT_SET(stats, cache_bytes_protected, cache->bytes_protected);
+	WT_STAT_SET(stats, cache_bytes_probation,
+	    __wt_cache_bytes_inuse(cache) -
+	    WT_MIN(cache->bytes_protected, __wt_cache_bytes_inuse(cache)));
+	WT_STAT_SET(stats, cache_eviction_workers, cache->evict_workers);
+
+	/*
+	 * Report how evenly pages are evicted across the worker threads: each
+	 * worker context keeps its own count, including the times the thread
+	 * was stopped and restarted.
+	 */
+	evicted_max = evicted_min = 0;
+	for (i = 0, worker = cache->evict_workctx;
+	    i < cache->evict_workers_open; i++, worker++) {
+		if (i == 0 || worker->pages_evicted > evicted_max)
+			evicted_max = worker->pages_evicted;
+		if (i == 0 || worker->pages_evicted < evicted_min)
+			evicted_min = worker->pages_evicted;
+	}
+	WT_STAT_SET(stats, cache_eviction_worker_evicting_max, evicted_max);
+	WT_STAT_SET(stats, cache_eviction_worker_evicting_min, evicted_min);
 }
 
 /*
@@ -155,10 +210,12 @@ __wt_cache_destroy(WT_CONNECTION_IMPL *conn)
 
 	WT_TRET(__wt_cond_destroy(session, &cache->evict_cond));
 	WT_TRET(__wt_cond_destroy(session, &cache->evict_waiter_cond));
+	WT_TRET(__wt_cond_destroy(session, &cache->wb_cond));
 	__wt_spin_destroy(session, &cache->evict_lock);
 	__wt_spin_destroy(session, &cache->evict_walk_lock);
 
 	__wt_free(session, cache->evict);
+	__wt_free(session, cache->evict_workctx);
 	__wt_free(session, conn->cache);
 	return (ret);
 }
@@ -7,6 +7,12 @@
 
 #include "wt_internal.h"
 
+/*
+ * Incremental checkpoints write dirty pages in small steps between
+ * checkpoints, one step every 100 milliseconds.
+ */
+#define	WT_CKPT_INCREMENTAL_USECS	100000
+
 /*
  * __ckpt_server_config --
  *	Parse and setup the checkpoint server options.
@@ -33,6 +39,9 @@ __ckpt_server_config(WT_SESSION_IMPL *session, const char **cfg, int *runp)
 	conn->ckpt_usecs = (long)cval.val * 1000000;
 	*runp = 1;
 
+	WT_RET(__wt_config_gets(session, cfg, "checkpoint.incremental", &cval));
+	conn->ckpt_incremental = cval.val != 0;
+
 	WT_RET(__wt_config_gets(session, cfg, "checkpoint.name", &cval));
 
 	if (!WT_STRING_MATCH(WT_CHECKPOINT, cval.str, cval.len)) {
@@ -48,6 +57,47 @@ __ckpt_server_config(WT_SESSION_IMPL *session, const char **cfg, int *runp)
 	return (0);
 }
 
+/*
+ * __ckpt_incremental --
+ *	Write dirty pages between checkpoints, at a rate that would write all of
+ * the cache's dirty data before the next checkpoint, so the checkpoint only
+ * has to write what's been dirtied since.
+ */
+static int
+__ckpt_incremental(WT_SESSION_IMPL *session)
+{
+	struct timespec now, start;
+	WT_CACHE *cache;
+	WT_CONNECTION_IMPL *conn;
+	uint64_t elapsed, remaining, steps;
+
+	conn = S2C(session);
+	cache = conn->cache;
+
+	WT_RET(__wt_epoch(session, &start));
+	while (F_ISSET(conn, WT_CONN_SERVER_RUN)) {
+		WT_RET(__wt_epoch(session, &now));
+		elapsed = WT_TIMEDIFF(now, start) / 1000;
+		if (elapsed >= (uint64_t)conn->ckpt_usecs)
+			break;
+		remaining = (uint64_t)conn->ckpt_usecs - elapsed;
+
+		/*
+		 * The rate is recalculated at each step from the dirty bytes in
+		 * the cache and the time remaining, so it follows changes in
+		 * the workload.
+		 */
+		steps = remaining / WT_CKPT_INCREMENTAL_USECS + 1;
+		if (cache->bytes_dirty / steps != 0)
+			WT_RET(__wt_write_behind_bytes(
+			    session, cache->bytes_dirty / steps));
+
+		WT_RET_TIMEDOUT_OK(__wt_cond_wait(session, conn->ckpt_cond,
+		    (long)WT_MIN(remaining, WT_CKPT_INCREMENTAL_USECS)));
+	}
+	return (0);
+}
+
 /*
  * __ckpt_server --
  *	The checkpoint server thread.
@@ -68,9 +118,12 @@ __ckpt_server(void *arg)
 		/* Checkpoint the database. */
 		WT_ERR(wt_session->checkpoint(wt_session, conn->ckpt_config));
 
-		/* Wait... */
-		WT_ERR_TIMEDOUT_OK(
-		    __wt_cond_wait(session, conn->ckpt_cond, conn->ckpt_usecs));
+		/* Wait, writing dirty pages if configured... */
+		if (conn->ckpt_incremental)
+			WT_ERR(__ckpt_incremental(session));
+		else
+			WT_ERR_TIMEDOUT_OK(__wt_cond_wait(
+			    session, conn->ckpt_cond, conn->ckpt_usecs));
 	}
 
 	if (0) {
@@ -79,6 +132,60 @@ err:		__wt_err(session, ret, "checkpoint server error");
 	return (NULL);
 }
 
+/*
+ * __ckpt_worker_config --
+ *	Parse the checkpoint worker thread configuration, and open the workers'
+ * sessions.
+ */
+static int
+__ckpt_worker_config(WT_SESSION_IMPL *session, const char **cfg)
+{
+	WT_CONFIG_ITEM cval;
+	WT_CONNECTION_IMPL *conn;
+	u_int i;
+
+	conn = S2C(session);
+
+	WT_RET(__wt_config_gets(session, cfg, "checkpoint.threads", &cval));
+	if (cval.val == 0)
+		return (0);
+
+	/*
+	 * The worker threads are started by each checkpoint, only one
+	 * checkpoint runs at a time, so the sessions are opened once and
+	 * shared by all checkpoints.
+	 */
+	WT_RET(__wt_calloc_def(
+	    session, WT_CKPT_THREADS_MAX, &conn->ckpt_worker_session));
+	for (i = 0; i < (u_int)cval.val; i++) {
+		WT_RET(__wt_open_session(
+		    conn, 1, NULL, NULL, &conn->ckpt_worker_session[i]));
+		conn->ckpt_worker_session[i]->name = "checkpoint-worker";
+		++conn->ckpt_threads;
+	}
+
+	return (0);
+}
+
+/*
+ * __ckpt_throttle_config --
+ *	Parse the checkpoint write throttle configuration.
+ */
+static int
+__ckpt_throttle_config(WT_SESSION_IMPL *session, const char **cfg)
+{
+	WT_CONFIG_ITEM cval;
+	WT_CONNECTION_IMPL *conn;
+
+	conn = S2C(session);
+
+	WT_RET(__wt_config_gets(
+	    session, cfg, "checkpoint.max_mb_per_sec", &cval));
+	conn->ckpt_throttle_rate = (uint64_t)cval.val * WT_MEGABYTE;
+
+	return (0);
+}
+
 /*
  * __wt_checkpoint_create --
  *	Start the checkpoint server thread.
@@ -91,6 +198,13 @@ __wt_checkpoint_create(WT_CONNECTION_IMPL *conn, const char *cfg[])
 
 	session = conn->default_session;
 
+	/*
+	 * Checkpoint workers and the write throttle are used by all
+	 * checkpoints, not just ours.
+	 */
+	WT_RET(__ckpt_worker_config(session, cfg));
+	WT_RET(__ckpt_throttle_config(session, cfg));
+
 	/* Handle configuration. */
 	WT_RET(__ckpt_server_config(session, cfg, &run));
 
@@ -125,6 +239,7 @@ __wt_checkpoint_destroy(WT_CONNECTION_IMPL *conn)
 	WT_DECL_RET;
 	WT_SESSION *wt_session;
 	WT_SESSION_IMPL *session;
+	u_int i;
 
 	session = conn->default_session;
 
@@ -143,5 +258,13 @@ __wt_checkpoint_destroy(WT_CONNECTION_IMPL *conn)
 		WT_TRET(wt_session->close(wt_session, NULL));
 	}
 
+	/* Close the checkpoint workers' sessions. */
+	for (i = 0; i < conn->ckpt_threads; i++) {
+		wt_session = &conn->ckpt_worker_session[i]->iface;
+		WT_TRET(wt_session->close(wt_session, NULL));
+	}
+	conn->ckpt_threads = 0;
+	__wt_free(session, conn->ckpt_worker_session);
+
 	return (ret);
 }
@@ -26,9 +26,27 @@ __logmgr_config(WT_SESSION_IMPL *session, const char **cfg, int *runp)
 	WT_CONFIG_ITEM cval, sval;
 	WT_CONNECTION_IMPL *conn;
 	WT_DECL_RET;
+	WT_NAMED_COMPRESSOR *ncomp;
 
 	conn = S2C(session);
 
+	/*
+	 * Configure the log record compressor even if logging is off, it's
+	 * needed to read existing log files.
+	 */
+	WT_RET(__wt_config_gets(session, cfg, "log.compressor", &cval));
+	if (cval.len > 0) {
+		TAILQ_FOREACH(ncomp, &conn->compqh, q)
+			if (WT_STRING_MATCH(ncomp->name, cval.str, cval.len)) {
+				conn->log_compressor = ncomp->compressor;
+				break;
+			}
+		if (conn->log_compressor == NULL)
+			WT_RET_MSG(session, EINVAL,
+			    "unknown log compressor '%.*s'",
+			    (int)cval.len, cval.str);
+	}
+
 	/*
 	 * The logging configuration is off by default.
 	 */
@@ -44,6 +62,15 @@ __logmgr_config(WT_SESSION_IMPL *session, const char **cfg, int *runp)
 	conn->log_file_max = (off_t)cval.val;
 	WT_STAT_FAST_CONN_SET(session, log_max_filesize, conn->log_file_max);
 
+	WT_RET(__wt_config_gets(session, cfg, "log.group_commit_usecs", &cval));
+	conn->log_group_usecs = (long)cval.val;
+
+	WT_RET(__wt_config_gets(session, cfg, "log.prealloc", &cval));
+	conn->log_prealloc = (uint32_t)cval.val;
+
+	WT_RET(__wt_config_gets(session, cfg, "log.recovery_threads", &cval));
+	conn->log_recovery_threads = (u_int)cval.val;
+
 	WT_RET(__wt_config_gets(session, cfg, "log.path", &cval));
 	WT_RET(__wt_strndup(session, cval.str, cval.len, &conn->log_path));
 
@@ -147,9 +174,136 @@ err:		__wt_err(session, ret, "log archive server error");
 	return (NULL);
 }
 
+/*
+ * __log_flush_server --
+ *	The log flush server thread: sync the log once for a group of commits.
+ */
+static void *
+__log_flush_server(void *arg)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+	WT_FH *fh;
+	WT_LOG *log;
+	WT_LSN lsn;
+	WT_SESSION_IMPL *session;
+	int locked;
+
+	session = arg;
+	conn = S2C(session);
+	log = conn->log;
+	locked = 0;
+
+	while (F_ISSET(conn, WT_CONN_SERVER_RUN)) {
+		/*
+		 * Wait until a commit needs the current log file synced: older
+		 * log files are synced when the log switches files.  Don't wait
+		 * forever: if a notification gets lost, we want to find out.
+		 */
+		__wt_spin_lock(session, &log->log_lock);
+		lsn = log->sync_req_lsn;
+		__wt_spin_unlock(session, &log->log_lock);
+		if (LOG_CMP(&log->sync_lsn, &lsn) >= 0 ||
+		    lsn.file != log->fileid) {
+			WT_ERR_TIMEDOUT_OK(__wt_cond_wait(
+			    session, conn->log_flush_cond, 100000));
+			continue;
+		}
+
+		/*
+		 * Give other commits a chance to join the group, then sync
+		 * everything they have written.
+		 */
+		__wt_sleep(0, conn->log_group_usecs);
+		__wt_spin_lock(session, &log->log_lock);
+		lsn = log->sync_req_lsn;
+		__wt_spin_unlock(session, &log->log_lock);
+
+		/*
+		 * Hold the sync lock so the log file can't be closed while we
+		 * sync it, and look up the file handle under the slot lock so
+		 * it matches the log file number.
+		 */
+		__wt_spin_lock(session, &log->log_sync_lock);
+		locked = 1;
+		__wt_spin_lock(session, &log->log_slot_lock);
+		fh = lsn.file == log->fileid ? log->log_fh : NULL;
+		__wt_spin_unlock(session, &log->log_slot_lock);
+		if (fh != NULL) {
+			WT_STAT_FAST_CONN_INCR(session, log_sync);
+			WT_ERR(__wt_fsync(session, fh));
+			if (LOG_CMP(&lsn, &log->sync_lsn) > 0)
+				log->sync_lsn = lsn;
+		}
+		__wt_spin_unlock(session, &log->log_sync_lock);
+		locked = 0;
+
+		WT_ERR(__wt_cond_signal(session, log->log_sync_cond));
+	}
+
+	if (0) {
+err:		if (locked)
+			__wt_spin_unlock(session, &log->log_sync_lock);
+
+		/*
+		 * Commits waiting for the log to be synced would wait forever
+		 * without this thread: tell them the log can't be synced, then
+		 * panic, there's no way to know what made it to disk.
+		 */
+		if (log->sync_error == 0)
+			log->sync_error = ret;
+		(void)__wt_cond_signal(session, log->log_sync_cond);
+		WT_PANIC_ERR(session, ret, "log flush server error");
+	}
+	return (NULL);
+}
+
+/*
+ * __log_prealloc_server --
+ *	The log pre-allocation server thread: keep log files ready for the log
+ *	to switch to.
+ */
+static void *
+__log_prealloc_server(void *arg)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+	WT_SESSION_IMPL *session;
+	u_int logcount;
+	char **logfiles;
+
+	session = arg;
+	conn = S2C(session);
+
+	while (F_ISSET(conn, WT_CONN_SERVER_RUN)) {
+		/*
+		 * Count the prepared files, and replace any the log has used.
+		 */
+		WT_ERR(__wt_dirlist(session, conn->log_path,
+		    WT_LOG_PREPNAME, WT_DIRLIST_INCLUDE, &logfiles, &logcount));
+		__wt_log_files_free(session, logfiles, logcount);
+		for (; logcount < conn->log_prealloc &&
+		    F_ISSET(conn, WT_CONN_SERVER_RUN); logcount++)
+			WT_ERR(__wt_log_prealloc(session));
+
+		/*
+		 * Wait until the log switches files.  Don't wait forever: if a
+		 * notification gets lost, we want to find out eventually.
+		 */
+		WT_ERR_TIMEDOUT_OK(
+		    __wt_cond_wait(session, conn->log_prealloc_cond, 1000000));
+	}
+
+	if (0) {
+err:		__wt_err(session, ret, "log pre-allocation server error");
+	}
+	return (NULL);
+}
+
 /*
  * __wt_logmgr_create --
- *	Start the log subsystem and archive server thread.
+ *	Start the log subsystem, the log flush, pre-allocation and archive
+ *	server threads.
  */
 int
 __wt_logmgr_create(WT_CONNECTION_IMPL *conn, const char *cfg[])
@@ -175,6 +329,7 @@ __wt_logmgr_create(WT_CONNECTION_IMPL *conn, const char *cfg[])
 	log = conn->log;
 	WT_RET(__wt_spin_init(session, &log->log_lock, "log"));
 	WT_RET(__wt_spin_init(session, &log->log_slot_lock, "log slot"));
+	WT_RET(__wt_spin_init(session, &log->log_sync_lock, "log sync"));
 	if (FLD_ISSET(conn->direct_io, WT_FILE_TYPE_LOG))
 		log->allocsize =
 		    WT_MAX((uint32_t)conn->buffer_alignment, LOG_ALIGN);
@@ -184,14 +339,47 @@ __wt_logmgr_create(WT_CONNECTION_IMPL *conn, const char *cfg[])
 	INIT_LSN(&log->ckpt_lsn);
 	INIT_LSN(&log->first_lsn);
 	INIT_LSN(&log->sync_lsn);
+	INIT_LSN(&log->sync_req_lsn);
 	INIT_LSN(&log->trunc_lsn);
 	INIT_LSN(&log->write_lsn);
 	log->fileid = 0;
 	WT_RET(__wt_cond_alloc(session,
 	    "log release", 0, &log->log_release_cond));
+	WT_RET(__wt_cond_alloc(session, "log sync", 0, &log->log_sync_cond));
+	if (conn->log_prealloc != 0)
+		WT_RET(__wt_cond_alloc(session,
+		    "log pre-allocation server", 0, &conn->log_prealloc_cond));
 	WT_RET(__wt_log_open(session));
 	WT_RET(__wt_log_slot_init(session));
 
+	/*
+	 * If group commit is configured, start the log flush server: it gets
+	 * its own session.
+	 */
+	if (conn->log_group_usecs != 0 && conn->log_flush_session == NULL) {
+		WT_RET(__wt_open_session(
+		    conn, 1, NULL, NULL, &conn->log_flush_session));
+		conn->log_flush_session->name = "log-flush-server";
+		WT_RET(__wt_cond_alloc(
+		    session, "log flush server", 0, &conn->log_flush_cond));
+		WT_RET(__wt_thread_create(session, &conn->log_flush_tid,
+		    __log_flush_server, conn->log_flush_session));
+		conn->log_flush_tid_set = 1;
+	}
+
+	/*
+	 * If pre-allocation is configured, start the log pre-allocation
+	 * server: it gets its own session.
+	 */
+	if (conn->log_prealloc != 0 && conn->log_prealloc_session == NULL) {
+		WT_RET(__wt_open_session(
+		    conn, 1, NULL, NULL, &conn->log_prealloc_session));
+		conn->log_prealloc_session->name = "log-prealloc-server";
+		WT_RET(__wt_thread_create(session, &conn->log_prealloc_tid,
+		    __log_prealloc_server, conn->log_prealloc_session));
+		conn->log_prealloc_tid_set = 1;
+	}
+
 	/* If archiving is not configured, we're done. */ 
 	if (!conn->archive)
 		return (0);
@@ -239,6 +427,35 @@ __wt_logmgr_destroy(WT_CONNECTION_IMPL *conn)
 
 	if (!conn->logging)
 		return (0);
+
+	/*
+	 * Stop the log flush server before closing the log: it syncs the
+	 * current log file.
+	 */
+	if (conn->log_flush_tid_set) {
+		WT_TRET(__wt_cond_signal(session, conn->log_flush_cond));
+		WT_TRET(__wt_thread_join(session, conn->log_flush_tid));
+		conn->log_flush_tid_set = 0;
+	}
+	WT_TRET(__wt_cond_destroy(session, &conn->log_flush_cond));
+	if (conn->log_flush_session != NULL) {
+		wt_session = &conn->log_flush_session->iface;
+		WT_TRET(wt_session->close(wt_session, NULL));
+		conn->log_flush_session = NULL;
+	}
+
+	if (conn->log_prealloc_tid_set) {
+		WT_TRET(__wt_cond_signal(session, conn->log_prealloc_cond));
+		WT_TRET(__wt_thread_join(session, conn->log_prealloc_tid));
+		conn->log_prealloc_tid_set = 0;
+	}
+	WT_TRET(__wt_cond_destroy(session, &conn->log_prealloc_cond));
+	if (conn->log_prealloc_session != NULL) {
+		wt_session = &conn->log_prealloc_session->iface;
+		WT_TRET(wt_session->close(wt_session, NULL));
+		conn->log_prealloc_session = NULL;
+	}
+
 	if (conn->arch_tid_set) {
 		WT_TRET(__wt_cond_signal(session, conn->arch_cond));
 		WT_TRET(__wt_thread_join(session, conn->arch_tid));
@@ -259,8 +476,10 @@ __wt_logmgr_destroy(WT_CONNECTION_IMPL *conn)
 
 	WT_TRET(__wt_log_slot_destroy(session));
 	WT_TRET(__wt_cond_destroy(session, &conn->log->log_release_cond));
+	WT_TRET(__wt_cond_destroy(session, &conn->log->log_sync_cond));
 	__wt_spin_destroy(session, &conn->log->log_lock);
 	__wt_spin_destroy(session, &conn->log->log_slot_lock);
+	__wt_spin_destroy(session, &conn->log->log_sync_lock);
 	__wt_free(session, conn->log);
 
 	return (ret);
@@ -26,6 +26,8 @@ __wt_connection_open(WT_CONNECTION_IMPL *conn, const char *cfg[])
 
 	/* Create the cache. */
 	WT_RET(__wt_cache_create(conn, cfg));
+	WT_RET(__wt_block_cache_create(conn, cfg));
+	WT_RET(__wt_buf_pool_create(conn, cfg));
 
 	/* Initialize transaction support. */
 	WT_RET(__wt_txn_global_init(conn, cfg));
@@ -78,6 +80,8 @@ __wt_connection_close(WT_CONNECTION_IMPL *conn)
 	 */
 	F_CLR(conn, WT_CONN_SERVER_RUN);
 	WT_TRET(__wt_checkpoint_destroy(conn));
+	WT_TRET(__wt_write_behind_destroy(conn));
+	WT_TRET(__wt_prefetch_destroy(conn));
 	WT_TRET(__wt_statlog_destroy(conn));
 
 	/* Clean up open LSM handles. */
@@ -123,19 +127,15 @@ __wt_connection_close(WT_CONNECTION_IMPL *conn)
 		fh = TAILQ_FIRST(&conn->fhqh);
 	}
 
-	/* Shut down the eviction server thread. */
-	F_CLR(conn, WT_CONN_EVICTION_RUN);
-	if (conn->cache_evict_tid_set) {
-		WT_TRET(__wt_evict_server_wake(session));
-		WT_TRET(__wt_thread_join(session, conn->cache_evict_tid));
-		conn->cache_evict_tid_set = 0;
-	}
+	/* Shut down the eviction server and worker threads. */
+	WT_TRET(__wt_evict_destroy(conn));
 
 	/* Disconnect from shared cache - must be before cache destroy. */
 	WT_TRET(__wt_conn_cache_pool_destroy(conn));
 
 	/* Discard the cache. */
 	WT_TRET(__wt_cache_destroy(conn));
+	WT_TRET(__wt_block_cache_destroy(conn));
 
 	/* Discard transaction state. */
 	__wt_txn_global_destroy(conn);
@@ -169,6 +169,12 @@ __wt_connection_close(WT_CONNECTION_IMPL *conn)
 			if (s != session)
 				__wt_free(session, s->hazard);
 
+	/*
+	 * Discard the I/O buffer pool, after the sessions' scratch buffers and
+	 * the cache's pages have returned their memory to it.
+	 */
+	WT_TRET(__wt_buf_pool_destroy(conn));
+
 	/* Destroy the handle. */
 	WT_TRET(__wt_connection_destroy(conn));
 
@@ -183,24 +189,13 @@ int
 __wt_connection_workers(WT_SESSION_IMPL *session, const char *cfg[])
 {
 	WT_CONNECTION_IMPL *conn;
-	WT_SESSION_IMPL *evict_session;
 
 	conn = S2C(session);
 
 	F_SET(conn, WT_CONN_EVICTION_RUN | WT_CONN_SERVER_RUN);
 
-	/*
-	 * Start the eviction thread.
-	 *
-	 * It needs a session handle because it is reading/writing pages.
-	 * Allocate a session here so the eviction thread never needs
-	 * to acquire the connection spinlock, which can lead to deadlock.
-	 */
-	WT_RET(__wt_open_session(conn, 1, NULL, NULL, &evict_session));
-	evict_session->name = "eviction-server";
-	WT_RET(__wt_thread_create(session,
-	    &conn->cache_evict_tid, __wt_cache_evict_server, evict_session));
-	conn->cache_evict_tid_set = 1;
+	/* Start the eviction thread. */
+	WT_RET(__wt_evict_create(conn));
 
 	/*
 	 * Start the optional statistics thread.  Start statistics first so that
@@ -214,5 +209,11 @@ __wt_connection_workers(WT_SESSION_IMPL *session, const char *cfg[])
 	/* Start the optional checkpoint thread. */
 	WT_RET(__wt_checkpoint_create(conn, cfg));
 
+	/* Start the optional write-behind threads. */
+	WT_RET(__wt_write_behind_create(conn, cfg));
+
+	/* Start the optional prefetch threads. */
+	WT_RET(__wt_prefetch_create(conn, cfg));
+
 	return (0);
 }
@@ -7,6 +7,21 @@
 
 #include "wt_internal.h"
 
+/*
+ * WT_CURFILE_SCAN_WRAP
+ *	Call an underlying btree function; if the cursor is configured for
+ * scans, the session doesn't trash the cache while it runs.
+ */
+#define	WT_CURFILE_SCAN_WRAP(session, cbt, e) do {			\
+	if (F_ISSET(cbt, WT_CBT_SCAN) &&				\
+	    !F_ISSET(session, WT_SESSION_NO_CACHE)) {			\
+		F_SET(session, WT_SESSION_NO_CACHE);			\
+		e;							\
+		F_CLR(session, WT_SESSION_NO_CACHE);			\
+	} else								\
+		e;							\
+} while (0)
+
 /*
  * WT_BTREE_CURSOR_SAVE_AND_RESTORE
  *	Save the cursor's key/value data/size fields, call an underlying btree
@@ -84,7 +99,8 @@ __curfile_next(WT_CURSOR *cursor)
 	CURSOR_API_CALL(cursor, session, next, cbt->btree);
 
 	F_CLR(cursor, WT_CURSTD_KEY_SET | WT_CURSTD_VALUE_SET);
-	if ((ret = __wt_btcur_next(cbt, 0)) == 0)
+	WT_CURFILE_SCAN_WRAP(session, cbt, ret = __wt_btcur_next(cbt, 0));
+	if (ret == 0)
 		F_SET(cursor, WT_CURSTD_KEY_INT | WT_CURSTD_VALUE_INT);
 
 err:	API_END(session);
@@ -129,7 +145,8 @@ __curfile_prev(WT_CURSOR *cursor)
 	CURSOR_API_CALL(cursor, session, prev, cbt->btree);
 
 	F_CLR(cursor, WT_CURSTD_KEY_SET | WT_CURSTD_VALUE_SET);
-	if ((ret = __wt_btcur_prev(cbt, 0)) == 0)
+	WT_CURFILE_SCAN_WRAP(session, cbt, ret = __wt_btcur_prev(cbt, 0));
+	if (ret == 0)
 		F_SET(cursor, WT_CURSTD_KEY_INT | WT_CURSTD_VALUE_INT);
 
 err:	API_END(session);
@@ -387,6 +404,10 @@ __wt_curfile_create(WT_SESSION_IMPL *session,
 		cursor->reset = __curfile_reset;
 	}
 
+	WT_ERR(__wt_config_gets_def(session, cfg, "scan", 0, &cval));
+	if (cval.val != 0)
+		F_SET(cbt, WT_CBT_SCAN);
+
 	/* __wt_cursor_init is last so we don't have to clean up on error. */
 	WT_ERR(__wt_cursor_init(cursor, cursor->uri, owner, cfg, cursorp));
 
@@ -144,6 +144,10 @@ struct __wt_bm {
 	int (*addr_valid)
 	    (WT_BM *, WT_SESSION_IMPL *, const uint8_t *, uint32_t);
 	u_int (*block_header)(WT_BM *);
+	int (*cache_get)(WT_BM *,
+	    WT_SESSION_IMPL *, WT_ITEM *, const uint8_t *, uint32_t, int *);
+	int (*cache_put)(WT_BM *,
+	    WT_SESSION_IMPL *, void *, size_t, const uint8_t *, uint32_t);
 	int (*checkpoint)
 	    (WT_BM *, WT_SESSION_IMPL *, WT_ITEM *, WT_CKPT *, int);
 	int (*checkpoint_load)(WT_BM *, WT_SESSION_IMPL *,
@@ -187,6 +191,56 @@ struct __wt_bm {
 	int is_live;				/* The live system */
 };
 
+/*
+ * WT_BLOCK_CACHE_ENTRY --
+ *	A page image in the block cache, keyed by the block it was read from.
+ */
+struct __wt_block_cache_entry {
+	WT_BLOCK *block;			/* Block address */
+	off_t	  offset;
+	uint32_t  size;
+	uint32_t  cksum;
+
+	void	 *image;			/* Page image */
+	size_t	  image_size;
+
+	TAILQ_ENTRY(__wt_block_cache_entry) hashq;	/* Hash bucket */
+	TAILQ_ENTRY(__wt_block_cache_entry) q;		/* LRU list */
+};
+
+/*
+ * WT_BLOCK_CACHE --
+ *	A connection-wide cache of the images of clean pages evicted from the
+ * WiredTiger cache.  Images move between the two caches rather than being
+ * copied: reading a page takes its image out of the block cache, evicting
+ * the page puts the image back.
+ */
+struct __wt_block_cache {
+	WT_SPINLOCK lock;			/* Block cache lock */
+
+	uint64_t bytes_max;			/* Maximum bytes */
+	uint64_t bytes_inuse;			/* Bytes held */
+
+	u_int	 hash_size;			/* Hash buckets */
+	TAILQ_HEAD(__wt_block_cache_hash, __wt_block_cache_entry) *hash;
+						/* LRU list, oldest first */
+	TAILQ_HEAD(__wt_block_cache_qh, __wt_block_cache_entry) lruqh;
+};
+
+/*
+ * WT_BLOCK_ARENA --
+ *	A range of the file reserved for block allocation.  Threads writing
+ * blocks allocate from an arena, and only lock the live checkpoint's extent
+ * lists when the arena's range is exhausted.
+ */
+#define	WT_BLOCK_ARENAS		8	/* Allocation arenas per file */
+#define	WT_BLOCK_ARENA_SIZE	(256 * 1024)
+struct __wt_block_arena {
+	WT_SPINLOCK lock;		/* Arena lock */
+	off_t	off;			/* Reserved range offset */
+	off_t	size;			/* Reserved range size */
+};
+
 /*
  * WT_BLOCK --
  *	Block manager handle, references a single file.
@@ -221,6 +275,39 @@ struct __wt_block {
 	WT_BLOCK_CKPT	live;		/* Live checkpoint */
 	int		ckpt_inprogress;/* Live checkpoint in progress */
 
+	/*
+	 * Ranges reserved for allocation are on the live checkpoint's alloc
+	 * list, the unused part of each range is returned to the avail list
+	 * before the checkpoint's extent lists are written.
+	 */
+	WT_BLOCK_ARENA	arena[WT_BLOCK_ARENAS];	/* Allocation arenas */
+
+	/*
+	 * Asynchronous writes: each slot holds a copy of a block being written,
+	 * so the caller's buffer can be re-used as soon as the write starts.
+	 * The slots are protected by the lock, one thread at a time waits for
+	 * writes to complete without holding it.
+	 */
+	WT_AIO	     *aio;		/* Asynchronous I/O context */
+	WT_SPINLOCK   aio_lock;		/* Asynchronous write lock */
+	WT_BLOCK_AIO *aio_slot;		/* Asynchronous write slots */
+	WT_AIO_EVENT *aio_events;	/* Asynchronous write completions */
+	u_int	      aio_pending;	/* Asynchronous writes in flight */
+	u_int	      aio_inflight;	/* Asynchronous writes not reaped */
+	int	      aio_reaping;	/* A thread is collecting writes */
+	int	      aio_error;	/* Deferred asynchronous write error */
+
+	/*
+	 * Live file memory map: readers copy blocks out of the map holding the
+	 * lock in read mode, the map is replaced with a larger one (holding the
+	 * lock in write mode) when a read falls past its end.
+	 */
+#define	WT_BLOCK_MAP_GROW	(64 * WT_MEGABYTE)
+	WT_RWLOCK *map_lock;		/* Map lock */
+	void	  *map;			/* Mapped region */
+	size_t	   maplen;		/* Mapped region length */
+	int	   map_failed;		/* Mapping failed, read the file */
+
 				/* Salvage support */
 	off_t	slvg_off;		/* Salvage file offset */
 
@@ -233,6 +320,19 @@ struct __wt_block {
 	uint8_t   *fragckpt;		/* Per-checkpoint frag tracking list */
 };
 
+/*
+ * WT_BLOCK_AIO --
+ *	An asynchronous block write.
+ */
+struct __wt_block_aio {
+	WT_ITEM	 buf;			/* Copy of the block */
+	off_t	 offset;		/* Block offset */
+	uint32_t size;			/* Block size */
+	uint32_t written;		/* Bytes written by a short write */
+	int	 busy;			/* Write in flight */
+	int	 finish;		/* Short write needs finishing */
+};
+
 /*
  * WT_BLOCK_DESC --
  *	The file's description.
@@ -181,6 +181,70 @@ struct __wt_ovfl_txnc {
 	WT_OVFL_TXNC *next[0];		/* Forward-linked skip list */
 };
 
+/*
+ * WT_PAGE_ARENA --
+ *	The WT_INSERT and WT_UPDATE structures added to a page are allocated
+ * from a per-page arena: a list of chunks handed out by bumping an offset, so
+ * most allocations don't go through the heap, and discarding the page frees a
+ * few chunks rather than every structure.  Whole chunks are charged to the
+ * page's memory footprint as they're allocated, so memory released into the
+ * arena remains charged until the page is discarded.
+ *
+ * Structures too large for the arena's free lists (typically updates with
+ * large values) couldn't be reused once released, so they're allocated from
+ * the heap, listed so discarding the page can find them, and freed as soon as
+ * they're released.
+ */
+struct __wt_page_arena_chunk {
+	WT_PAGE_ARENA_CHUNK *next;	/* Owning page's chunk list */
+
+	/*
+	 * A chunk is referenced by the page that allocated it, and by pages
+	 * structures it holds were moved to by in-memory splits.
+	 */
+	volatile uint32_t ref;		/* Pages referencing the chunk */
+
+	uint32_t size;			/* Chunk memory length */
+	volatile uint32_t off;		/* Next free byte */
+
+	/* The chunk's memory immediately follows the structure. */
+#define	WT_PAGE_ARENA_CHUNK_DATA(chunk)					\
+	((uint8_t *)(chunk) + WT_ALIGN(sizeof(WT_PAGE_ARENA_CHUNK), 8))
+};
+
+struct __wt_page_arena_ref {
+	WT_PAGE_ARENA_REF *next;	/* Shared chunk list */
+	WT_PAGE_ARENA_CHUNK *chunk;	/* Another page's chunk */
+};
+
+struct __wt_page_arena_large {
+	WT_PAGE_ARENA_LARGE *next;	/* Owning page's large list */
+	WT_PAGE_ARENA_LARGE *prev;
+	size_t size;			/* Allocation length */
+
+	/* The structure immediately follows. */
+#define	WT_PAGE_ARENA_LARGE_DATA(large)					\
+	((uint8_t *)(large) + WT_ALIGN(sizeof(WT_PAGE_ARENA_LARGE), 8))
+};
+
+struct __wt_page_arena {
+	WT_PAGE_ARENA_CHUNK * volatile chunk;	/* Chunks, current first */
+	WT_PAGE_ARENA_REF *shared;		/* Other pages' chunks */
+	WT_PAGE_ARENA_LARGE *large;		/* Heap-allocated structures */
+
+#define	WT_PAGE_ARENA_CHUNK_MIN	(2 * 1024)	/* Chunk sizes */
+#define	WT_PAGE_ARENA_CHUNK_MAX	(64 * 1024)
+	uint32_t chunk_size;			/* Next chunk's size */
+
+	/*
+	 * Structures released before the page is discarded (obsolete updates
+	 * and structures from failed operations) are kept on free lists by
+	 * size and reused by the page.
+	 */
+#define	WT_PAGE_ARENA_FREE_CLASSES	32	/* 8B classes, up to 256B */
+	void *freeq[WT_PAGE_ARENA_FREE_CLASSES];
+};
+
 /*
  * WT_PAGE_MODIFY --
  *	When a page is modified, there's additional information maintained as it
@@ -226,6 +290,8 @@ struct __wt_page_modify {
 	 */
 	WT_INSERT_HEAD **update;	/* Updated items */
 
+	WT_PAGE_ARENA *arena;		/* Insert/update memory */
+
 	/* Overflow record tracking. */
 	struct __wt_ovfl_track {
 		WT_OVFL_ONPAGE	*ovfl_onpage[WT_SKIP_MAXDEPTH];
@@ -235,6 +301,13 @@ struct __wt_page_modify {
 
 	uint64_t bytes_dirty;		/* Dirty bytes added to cache. */
 
+	/*
+	 * A unique ID for the page's modifications: cursors check it before
+	 * using a finger they left in one of the page's insert lists, the
+	 * page may have been discarded and its memory reused since.
+	 */
+	uint64_t id;
+
 	/*
 	 * The write generation is incremented when a page is modified, a page
 	 * is clean if the write generation is 0.
@@ -306,6 +379,9 @@ struct __wt_page {
 			 */
 			WT_INSERT_HEAD	**ins;	/* Inserts */
 			WT_UPDATE	**upd;	/* Updates */
+
+			WT_ROW_HASH	*srch_hash;	/* Search hash index */
+			uint32_t	 srch_count;	/* Page searches */
 		} row;
 
 		/* Fixed-length column-store leaf page. */
@@ -361,6 +437,12 @@ struct __wt_page {
 #define	WT_READ_GEN_STEP	1000
 	uint64_t read_gen;
 
+	/*
+	 * If the page is on the LRU eviction queue, the queue slot referencing
+	 * it, so the page can be removed from the queue without a search.
+	 */
+	uint32_t evict_slot;
+
 	/*
 	 * In-memory pages optionally reference a number of entries originally
 	 * read from disk and sizes the allocated arrays that describe the page.
@@ -384,7 +466,16 @@ struct __wt_page {
 #define	WT_PAGE_DISK_MAPPED	0x04	/* Disk image in mapped memory */
 #define	WT_PAGE_EVICT_LRU	0x08	/* Page is on the LRU queue */
 #define	WT_PAGE_WAS_SPLIT	0x10	/* Page has been split in memory */
+#define	WT_PAGE_PROTECTED	0x20	/* Page is in the protected segment */
+#define	WT_PAGE_PREFETCH	0x40	/* Page read by a prefetch thread */
+#define	WT_PAGE_DISK_POOL	0x80	/* Disk image from the buffer pool */
 	uint8_t flags_atomic;		/* Atomic flags, use F_*_ATOMIC */
+
+	/*
+	 * The buffer pool size class of the disk image's memory, which may be
+	 * larger than the image.
+	 */
+	uint8_t dsk_pool_class;
 };
 
 /*
@@ -461,6 +552,23 @@ enum __wt_page_state {
 	WT_REF_READING			/* Page being read */
 };
 
+/*
+ * WT_ROW_HASH --
+ *	A hash index for a row-store leaf page, mapping the keys in the page's
+ * WT_ROW array to their slots, so searches for those keys don't binary search
+ * the page.  Open addressing with linear probing: each bucket holds the high
+ * 32 bits of the key's hash and the key's slot plus 1 (0 is an empty bucket).
+ * Keys on the page's insert lists aren't indexed, searches for them fall back
+ * to the binary search.
+ */
+struct __wt_row_hash {
+	uint32_t  mask;			/* Buckets - 1 */
+	uint64_t *bucket;		/* Hash tag, WT_ROW slot + 1 */
+
+#define	WT_ROW_HASH_MIN		32	/* Index pages with more entries */
+#define	WT_ROW_HASH_HOT		100	/* Index pages after more searches */
+};
+
 /*
  * WT_REF --
  *	A single in-memory page and the state information used to determine if
@@ -772,6 +880,28 @@ struct __wt_insert {
 /*
  * WT_INSERT_HEAD --
  * 	The head of a skiplist of WT_INSERT items.
+ *
+ * Threads insert into the skiplist concurrently:
+ *
+ * - Level 0 of the skiplist is the list, the levels above it only speed up
+ *   searches.  A new item is linked into its levels bottom-up, so an item
+ *   found at a level is in every level below it.
+ *
+ * - An item is linked into a level by an atomic swap of its predecessor's
+ *   next pointer, from the successor found by the search to the new item.
+ *   If the swap fails at level 0, another thread inserted where the item
+ *   belongs and the insert is retried.  If it fails at a higher level, the
+ *   item stays linked into the levels below it.
+ *
+ * - Items aren't removed from the list while the page is in memory, except
+ *   by an in-memory split, which has exclusive access to the page.
+ *
+ * - Only inserts that change the tail of a level (the item has no successor
+ *   at that level), take the page's spinlock, which serializes updates of
+ *   the tail array.  Threads inserting in the middle of every level don't
+ *   lock the page, but never swap a NULL next pointer, so they can't race
+ *   with a change to the tail.  An append that lost a race with another
+ *   append is moved to the new end of the list if its key still sorts last.
  */
 struct __wt_insert_head {
 	WT_INSERT *head[WT_SKIP_MAXDEPTH];	/* first item on skiplists */
@@ -77,6 +77,9 @@ struct __wt_btree {
 	uint32_t maxleafitem;		/* Leaf page max item size */
 	uint64_t maxmempage;		/* In memory page max size */
 
+	uint32_t read_ahead;		/* Cursor scan read-ahead pages */
+	int	 leaf_hash_index;	/* Leaf page hash index */
+
 	void *huffman_key;		/* Key huffman encoding */
 	void *huffman_value;		/* Value huffman encoding */
 
@@ -37,6 +37,8 @@ __wt_cache_page_inmem_incr(WT_SESSION_IMPL *session, WT_PAGE *page, size_t size)
 	cache = S2C(session)->cache;
 	(void)WT_ATOMIC_ADD(cache->bytes_inmem, size);
 	(void)WT_ATOMIC_ADD(page->memory_footprint, WT_STORE_SIZE(size));
+	if (F_ISSET_ATOMIC(page, WT_PAGE_PROTECTED))
+		(void)WT_ATOMIC_ADD(cache->bytes_protected, size);
 	if (__wt_page_is_modified(page)) {
 		(void)WT_ATOMIC_ADD(cache->bytes_dirty, size);
 		(void)WT_ATOMIC_ADD(page->modify->bytes_dirty, size);
@@ -57,6 +59,8 @@ __wt_cache_page_inmem_decr(WT_SESSION_IMPL *session, WT_PAGE *page, size_t size)
 	cache = S2C(session)->cache;
 	(void)WT_ATOMIC_SUB(cache->bytes_inmem, size);
 	(void)WT_ATOMIC_SUB(page->memory_footprint, WT_STORE_SIZE(size));
+	if (F_ISSET_ATOMIC(page, WT_PAGE_PROTECTED))
+		(void)WT_ATOMIC_SUB(cache->bytes_protected, size);
 	if (__wt_page_is_modified(page)) {
 		(void)WT_ATOMIC_SUB(cache->bytes_dirty, size);
 		(void)WT_ATOMIC_SUB(page->modify->bytes_dirty, size);
@@ -125,6 +129,31 @@ __wt_cache_dirty_decr(WT_SESSION_IMPL *session, WT_PAGE *page)
 	(void)WT_ATOMIC_SUB(page->modify->bytes_dirty, size);
 }
 
+/*
+ * __wt_cache_page_protect --
+ *	Move a page from the cache's probationary segment to its protected
+ * segment.
+ */
+static inline void
+__wt_cache_page_protect(WT_SESSION_IMPL *session, WT_PAGE *page)
+{
+	WT_CACHE *cache;
+	uint8_t orig;
+
+	cache = S2C(session)->cache;
+
+	/* Only one thread gets to move the page and count its bytes. */
+	do {
+		orig = page->flags_atomic;
+		if (FLD_ISSET(orig, WT_PAGE_PROTECTED))
+			return;
+	} while (!WT_ATOMIC_CAS(page->flags_atomic,
+	    orig, (uint8_t)(orig | WT_PAGE_PROTECTED)));
+
+	(void)WT_ATOMIC_ADD(cache->bytes_protected, page->memory_footprint);
+	WT_STAT_FAST_CONN_INCR(session, cache_pages_protected);
+}
+
 /*
  * __wt_cache_page_evict --
  *	Evict pages from the cache.
@@ -134,6 +163,7 @@ __wt_cache_page_evict(WT_SESSION_IMPL *session, WT_PAGE *page)
 {
 	WT_CACHE *cache;
 	WT_PAGE_MODIFY *mod;
+	size_t size;
 
 	cache = S2C(session)->cache;
 	mod = page->modify;
@@ -146,6 +176,15 @@ __wt_cache_page_evict(WT_SESSION_IMPL *session, WT_PAGE *page)
 	if (mod != NULL && mod->bytes_dirty != 0)
 		(void)WT_ATOMIC_SUB(cache->bytes_dirty, mod->bytes_dirty);
 
+	/*
+	 * Take care the protected size doesn't go negative, we may have raced
+	 * tracking the page's footprint when it was protected.
+	 */
+	if (F_ISSET_ATOMIC(page, WT_PAGE_PROTECTED)) {
+		size = WT_MIN(page->memory_footprint, cache->bytes_protected);
+		(void)WT_ATOMIC_SUB(cache->bytes_protected, size);
+	}
+
 	WT_ASSERT(session, page->memory_footprint != 0);
 	(void)WT_ATOMIC_ADD(cache->bytes_evict, page->memory_footprint);
 	page->memory_footprint = 0;
@@ -216,6 +255,7 @@ __wt_page_modify_init(WT_SESSION_IMPL *session, WT_PAGE *page)
 	 * keep things from racing too badly.
 	 */
 	modify->page_lock = ++conn->page_lock_cnt % WT_PAGE_LOCKS(conn);
+	modify->id = WT_ATOMIC_ADD(conn->page_modify_id, 1);
 
 	/*
 	 * Multiple threads of control may be searching and deciding to modify
@@ -737,6 +777,47 @@ __wt_btree_size_overflow(WT_SESSION_IMPL *session, uint64_t maxsize)
 	return (child->memory_footprint > maxsize);
 }
 
+/*
+ * __wt_lex_prefix --
+ *	Return the length of the common prefix of two byte strings.
+ *
+ * Keys often share long prefixes, compare them 16 bytes at a time where SSE2
+ * is available (it's part of the x86-64 instruction set, so there's no need
+ * to check at run-time), then 8 bytes at a time, finding the mismatched byte
+ * in the last chunk a byte at a time.
+ */
+static inline uint32_t
+__wt_lex_prefix(const uint8_t *userp, const uint8_t *treep, uint32_t len)
+{
+	const uint8_t *start;
+	uint64_t u, t;
+#ifdef __SSE2__
+	int eq;
+#endif
+
+	start = userp;
+
+#ifdef __SSE2__
+	for (; len >= 16; len -= 16, userp += 16, treep += 16) {
+		eq = _mm_movemask_epi8(_mm_cmpeq_epi8(
+		    _mm_loadu_si128((const __m128i *)userp),
+		    _mm_loadu_si128((const __m128i *)treep)));
+		if (eq != 0xffff)
+			return (WT_PTRDIFF32(userp, start) +
+			    (uint32_t)__builtin_ctz((u_int)~eq));
+	}
+#endif
+	for (; len >= 8; len -= 8, userp += 8, treep += 8) {
+		memcpy(&u, userp, sizeof(u));
+		memcpy(&t, treep, sizeof(t));
+		if (u != t)
+			break;
+	}
+	for (; len > 0 && *userp == *treep; --len, ++userp, ++treep)
+		;
+	return (WT_PTRDIFF32(userp, start));
+}
+
 /*
  * __wt_lex_compare --
  *	Lexicographic comparison routine.
@@ -753,17 +834,16 @@ static inline int
 __wt_lex_compare(const WT_ITEM *user_item, const WT_ITEM *tree_item)
 {
 	const uint8_t *userp, *treep;
-	uint32_t len, usz, tsz;
+	uint32_t len, match, usz, tsz;
 
 	usz = user_item->size;
 	tsz = tree_item->size;
 	len = WT_MIN(usz, tsz);
 
-	for (userp = user_item->data, treep = tree_item->data;
-	    len > 0;
-	    --len, ++userp, ++treep)
-		if (*userp != *treep)
-			return (*userp < *treep ? -1 : 1);
+	userp = user_item->data;
+	treep = tree_item->data;
+	if ((match = __wt_lex_prefix(userp, treep, len)) < len)
+		return (userp[match] < treep[match] ? -1 : 1);
 
 	/* Contents are equal up to the smallest length. */
 	return ((usz == tsz) ? 0 : (usz < tsz) ? -1 : 1);
@@ -791,18 +871,18 @@ __wt_lex_compare_skip(
     const WT_ITEM *user_item, const WT_ITEM *tree_item, uint32_t *matchp)
 {
 	const uint8_t *userp, *treep;
-	uint32_t len, usz, tsz;
+	uint32_t len, match, usz, tsz;
 
 	usz = user_item->size;
 	tsz = tree_item->size;
 	len = WT_MIN(usz, tsz) - *matchp;
 
-	for (userp = (uint8_t *)user_item->data + *matchp,
-	    treep = (uint8_t *)tree_item->data + *matchp;
-	    len > 0;
-	    --len, ++userp, ++treep, ++*matchp)
-		if (*userp != *treep)
-			return (*userp < *treep ? -1 : 1);
+	userp = (uint8_t *)user_item->data + *matchp;
+	treep = (uint8_t *)tree_item->data + *matchp;
+	match = __wt_lex_prefix(userp, treep, len);
+	*matchp += match;
+	if (match < len)
+		return (userp[match] < treep[match] ? -1 : 1);
 
 	/* Contents are equal up to the smallest length. */
 	return ((usz == tsz) ? 0 : (usz < tsz) ? -1 : 1);
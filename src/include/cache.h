@@ -12,10 +12,22 @@
 #define	WT_EVICT_INT_SKEW  (1<<12)	/* Prefer leaf pages over internal
 					   pages by this many increments of the
 					   read generation. */
+#define	WT_EVICT_PROTECTED_SKEW	(1<<14)	/* Prefer probationary pages over
+					   protected pages by this many
+					   increments of the read generation,
+					   when scan-resistant. */
+#define	WT_EVICT_PROBATION_PCT	25	/* Probationary share of the cache */
 #define	WT_EVICT_WALK_PER_FILE	10	/* Pages to visit per file */
 #define	WT_EVICT_WALK_BASE     300	/* Pages tracked across file visits */
 #define	WT_EVICT_WALK_INCR     100	/* Pages added each walk */
 
+#define	WT_EVICT_MAX_WORKERS	20	/* Maximum eviction worker threads */
+#define	WT_EVICT_QUEUE_PARTS	8	/* LRU queue partitions */
+#define	WT_WRITE_BEHIND_MAX	8	/* Maximum write-behind threads */
+#define	WT_PREFETCH_MAX		8	/* Maximum prefetch threads */
+#define	WT_PREFETCH_QUEUE	1024	/* Prefetch queue slots */
+#define	WT_PREFETCH_COMPACT	8	/* Pages prefetched ahead of compact */
+
 /*
  * WT_EVICT_ENTRY --
  *	Encapsulation of an eviction candidate.
@@ -23,6 +35,43 @@
 struct __wt_evict_entry {
 	WT_BTREE *btree;			/* Enclosing btree object */
 	WT_PAGE	 *page;				/* Page to flush/evict */
+	uint64_t  score;			/* Adjusted read generation */
+};
+
+/*
+ * WT_PREFETCH_ENTRY --
+ *	A page queued for the prefetch threads.
+ */
+struct __wt_prefetch_entry {
+	WT_BTREE *btree;			/* Enclosing btree object */
+	WT_PAGE	 *parent;			/* Parent page */
+	WT_REF	 *ref;				/* Page reference */
+};
+
+/*
+ * WT_EVICT_PART --
+ *	A partition of the LRU eviction queue.  The queue is striped
+ * across the partitions: partition N hands out queue slots N, N plus the
+ * number of partitions, and so on.  Each partition lives in its own cache
+ * line so threads choosing pages to evict don't contend with each other.
+ */
+struct __wt_evict_part {
+	volatile uint32_t next;		/* Next queue slot to hand out */
+	volatile uint32_t active;	/* Threads using the queue */
+} WT_GCC_ATTRIBUTE((aligned(WT_CACHE_LINE_ALIGNMENT)));
+
+/*
+ * WT_EVICT_WORKER --
+ *	Encapsulation of an eviction worker thread.
+ */
+struct __wt_evict_worker {
+	WT_SESSION_IMPL *session;	/* Worker session */
+	u_int	  id;			/* Worker ID */
+	pthread_t tid;			/* Worker thread ID */
+	uint64_t  pages_evicted;	/* Pages evicted by this worker */
+
+#define	WT_EVICT_WORKER_RUN	0x01	/* Worker thread is running */
+	uint32_t  flags;
 };
 
 /*
@@ -42,6 +91,7 @@ struct __wt_cache {
 	uint64_t pages_evict;
 	uint64_t bytes_dirty;		/* Bytes/pages currently dirty */
 	uint64_t pages_dirty;
+	uint64_t bytes_protected;	/* Bytes in the protected segment */
 
 	/*
 	 * Read information.
@@ -52,7 +102,7 @@ struct __wt_cache {
 	 * Eviction thread information.
 	 */
 	WT_CONDVAR *evict_cond;		/* Eviction server condition */
-	WT_SPINLOCK evict_lock;		/* Eviction LRU queue */
+	WT_SPINLOCK evict_lock;		/* Eviction LRU queue rearrangement */
 	WT_SPINLOCK evict_walk_lock;	/* Eviction walk location */
 	/* Condition signalled when the eviction server populates the queue */
 	WT_CONDVAR *evict_waiter_cond;
@@ -60,19 +110,63 @@ struct __wt_cache {
 	u_int eviction_trigger;		/* Percent to trigger eviction */
 	u_int eviction_target;		/* Percent to end eviction */
 	u_int eviction_dirty_target;    /* Percent to allow dirty */
+	int   eviction_scan_resistant;	/* Evict probationary pages first */
+
+	/*
+	 * Eviction worker threads: the eviction server walks and orders the
+	 * LRU queue, worker threads (if configured) drain it.
+	 */
+	WT_EVICT_WORKER *evict_workctx;	/* Eviction worker contexts */
+	u_int evict_workers_max;	/* Maximum running eviction workers */
+	u_int evict_workers_min;	/* Minimum running eviction workers */
+	u_int evict_workers;		/* Running eviction workers */
+	u_int evict_workers_open;	/* Worker sessions opened */
 
 	/*
 	 * LRU eviction list information.
+	 *
+	 * Threads take pages from the queue without locking: a thread joins
+	 * a partition's active count, claims queue slots from the partition
+	 * with an atomic increment, and claims the page in a slot by swapping
+	 * the slot's page pointer to NULL.  Operations that rearrange the
+	 * queue (ordering it or removing a file's pages) hold the evict_lock,
+	 * set evict_exclusive and wait for the partitions to go idle.
 	 */
 	WT_EVICT_ENTRY *evict;		/* LRU pages being tracked */
-	WT_EVICT_ENTRY *evict_current;	/* LRU current page to be evicted */
-	uint32_t evict_candidates;	/* LRU list pages to evict */
+	WT_EVICT_PART evict_part[WT_EVICT_QUEUE_PARTS];
+	volatile int evict_exclusive;	/* LRU queue being rearranged */
+	volatile uint32_t
+		evict_candidates;	/* LRU list pages to evict */
 	uint32_t evict_entries;		/* LRU entries in the queue */
 	volatile uint32_t evict_max;	/* LRU maximum eviction slot used */
 	uint32_t evict_slots;		/* LRU list eviction slots */
 	WT_DATA_HANDLE
 		*evict_file_next;	/* LRU next file to search */
 
+	/*
+	 * Write-behind threads write dirty leaf pages in the background,
+	 * ahead of eviction.
+	 */
+	WT_CONDVAR *wb_cond;		/* Write-behind thread condition */
+	WT_SESSION_IMPL **wb_session;	/* Write-behind thread sessions */
+	pthread_t *wb_tid;		/* Write-behind thread IDs */
+	u_int wb_threads;		/* Write-behind threads running */
+	WT_DATA_HANDLE
+		*wb_file_next;		/* Write-behind next file to write */
+
+	/*
+	 * Prefetch threads read queued pages into the cache in the background,
+	 * ahead of the threads that will use them.
+	 */
+	WT_CONDVAR *pf_cond;		/* Prefetch thread condition */
+	WT_SESSION_IMPL **pf_session;	/* Prefetch thread sessions */
+	pthread_t *pf_tid;		/* Prefetch thread IDs */
+	u_int pf_threads;		/* Prefetch threads running */
+	WT_SPINLOCK pf_lock;		/* Prefetch queue lock */
+	WT_PREFETCH_ENTRY *pf_queue;	/* Prefetch queue */
+	u_int pf_first;			/* Prefetch queue first entry */
+	u_int pf_count;			/* Prefetch queue entries */
+
 	/*
 	 * Sync/flush request information.
 	 */
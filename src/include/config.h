@@ -58,15 +58,16 @@ struct __wt_config_entry {
 #define	WT_CONFIG_ENTRY_session_drop			18
 #define	WT_CONFIG_ENTRY_session_log_printf		19
 #define	WT_CONFIG_ENTRY_session_open_cursor		20
-#define	WT_CONFIG_ENTRY_session_reconfigure		21
-#define	WT_CONFIG_ENTRY_session_rename			22
-#define	WT_CONFIG_ENTRY_session_rollback_transaction	23
-#define	WT_CONFIG_ENTRY_session_salvage			24
-#define	WT_CONFIG_ENTRY_session_truncate		25
-#define	WT_CONFIG_ENTRY_session_upgrade			26
-#define	WT_CONFIG_ENTRY_session_verify			27
-#define	WT_CONFIG_ENTRY_table_meta			28
-#define	WT_CONFIG_ENTRY_wiredtiger_open			29
+#define	WT_CONFIG_ENTRY_session_prefetch		21
+#define	WT_CONFIG_ENTRY_session_reconfigure		22
+#define	WT_CONFIG_ENTRY_session_rename			23
+#define	WT_CONFIG_ENTRY_session_rollback_transaction	24
+#define	WT_CONFIG_ENTRY_session_salvage			25
+#define	WT_CONFIG_ENTRY_session_truncate		26
+#define	WT_CONFIG_ENTRY_session_upgrade			27
+#define	WT_CONFIG_ENTRY_session_verify			28
+#define	WT_CONFIG_ENTRY_table_meta			29
+#define	WT_CONFIG_ENTRY_wiredtiger_open			30
 /*
  * configuration section: END
  * DO NOT EDIT: automatically built by dist/flags.py.
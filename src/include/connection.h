@@ -53,11 +53,35 @@ struct __wt_named_data_source {
 	TAILQ_ENTRY(__wt_named_data_source) q;
 };
 
+/*
+ * WT_BUF_POOL --
+ *	A pool of aligned I/O buffers shared by all of the connection's
+ * sessions.  Freed buffers are kept on per-size free lists, linked through
+ * the buffers' memory, and handed out again instead of returning them to the
+ * allocator.  Size classes are multiples of the pool's unit.
+ */
+#define	WT_BUF_POOL_CLASSES	256		/* Size classes */
+struct __wt_buf_pool {
+	WT_SPINLOCK lock;		/* Buffer pool lock */
+
+	size_t	 unit;			/* Size class unit */
+	uint64_t bytes_max;		/* Maximum bytes */
+	uint64_t bytes_inuse;		/* Bytes on the free lists */
+
+	void	*freeq[WT_BUF_POOL_CLASSES];	/* Free lists */
+};
+
 /*
  * Allocate some additional slots for internal sessions.  There is a default
- * session for each connection, plus a session for the eviction thread.
+ * session for each connection, plus a session for the eviction thread and
+ * for each eviction worker, write-behind, prefetch and checkpoint worker
+ * thread that might be configured.
+ * Recovery worker threads exit before the write-behind threads start, and
+ * use the same slots.
  */
-#define	WT_NUM_INTERNAL_SESSIONS	2
+#define	WT_NUM_INTERNAL_SESSIONS					\
+	(4 + WT_EVICT_MAX_WORKERS + WT_WRITE_BEHIND_MAX + WT_PREFETCH_MAX +\
+	WT_CKPT_THREADS_MAX)
 
 /*
  * Periodically clear out unused dhandles from the connection list.
@@ -90,6 +114,7 @@ struct __wt_connection_impl {
 #define	WT_PAGE_LOCKS(conn)	16
 	WT_SPINLOCK *page_lock;	        /* Btree page spinlocks */
 	u_int	     page_lock_cnt;	/* Next spinlock to use */
+	uint64_t     page_modify_id;	/* Next page modify ID */
 
 					/* Connection queue */
 	TAILQ_ENTRY(__wt_connection_impl) q;
@@ -155,6 +180,9 @@ struct __wt_connection_impl {
 	WT_CACHE  *cache;		/* Page cache */
 	uint64_t   cache_size;
 
+	WT_BLOCK_CACHE *block_cache;	/* Block cache */
+	WT_BUF_POOL *buf_pool;		/* I/O buffer pool */
+
 	WT_TXN_GLOBAL txn_global;	/* Global transaction state */
 
 	WT_SPINLOCK hot_backup_lock;	/* Hot backup serialization */
@@ -166,6 +194,16 @@ struct __wt_connection_impl {
 	WT_CONDVAR	*ckpt_cond;	/* Checkpoint wait mutex */
 	const char	*ckpt_config;	/* Checkpoint configuration */
 	long		 ckpt_usecs;	/* Checkpoint period */
+	int		 ckpt_incremental;	/* Write between checkpoints */
+					/* Checkpoint write throttle */
+	WT_SPINLOCK	 ckpt_throttle_lock;
+	uint64_t	 ckpt_throttle_rate;	/* Bytes per second */
+	int64_t		 ckpt_throttle_avail;	/* Bytes available to write */
+	struct timespec	 ckpt_throttle_last;	/* Last refill */
+#define	WT_CKPT_THREADS_MAX	8	/* Maximum checkpoint worker threads */
+	u_int		 ckpt_threads;	/* Checkpoint worker threads */
+					/* Checkpoint worker sessions */
+	WT_SESSION_IMPL **ckpt_worker_session;
 
 	int compact_in_memory_pass;	/* Compaction serialization */
 
@@ -213,6 +251,18 @@ struct __wt_connection_impl {
 	int		 arch_tid_set;	/* Log archive thread set */
 	WT_LOG		*log;		/* Logging structure */
 	off_t		log_file_max;	/* Log file max size */
+	WT_COMPRESSOR	*log_compressor;	/* Log record compressor */
+	long		 log_group_usecs;	/* Log group commit window */
+	WT_CONDVAR	*log_flush_cond;	/* Log flush wait mutex */
+	WT_SESSION_IMPL *log_flush_session;	/* Log flush session */
+	pthread_t	 log_flush_tid;		/* Log flush thread */
+	int		 log_flush_tid_set;	/* Log flush thread set */
+	uint32_t	 log_prealloc;		/* Log files to prepare */
+	WT_CONDVAR	*log_prealloc_cond;	/* Log prealloc wait mutex */
+	WT_SESSION_IMPL *log_prealloc_session;	/* Log prealloc session */
+	pthread_t	 log_prealloc_tid;	/* Log prealloc thread */
+	int		 log_prealloc_tid_set;	/* Log prealloc thread set */
+	u_int		 log_recovery_threads;	/* Log recovery threads */
 	const char	*log_path;	/* Logging path format */
 	uint32_t	txn_logsync;	/* Log sync configuration */
 
@@ -227,6 +277,8 @@ struct __wt_connection_impl {
 
 	void	*lang_private;		/* Language specific private storage */
 
+	u_int	aio_depth;		/* Asynchronous write queue depth */
+
 	/* If non-zero, all buffers used for I/O will be aligned to this. */
 	size_t buffer_alignment;
 
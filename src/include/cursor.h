@@ -91,6 +91,18 @@ struct __wt_cursor_btree {
 					/* Next item(s) found during search */
 	WT_INSERT	*next_stack[WT_SKIP_MAXDEPTH];
 
+	/*
+	 * After a row-store insert, the cursor keeps a "finger": the inserted
+	 * item and the search stack leading to the item's successors.  The
+	 * next search of the same insert list for a larger key starts there,
+	 * so cursors inserting increasing keys (for example, time-series
+	 * data), don't search the list from the top.
+	 */
+	uint64_t	 finger_id;	/* Page modify ID */
+	WT_INSERT_HEAD	*finger_head;	/* Insert chain head */
+	WT_INSERT	*finger_ins;	/* Inserted item */
+	WT_INSERT	**finger_stack[WT_SKIP_MAXDEPTH];
+
 	uint64_t recno;			/* Record number */
 
 	/*
@@ -162,7 +174,8 @@ struct __wt_cursor_btree {
 #define	WT_CBT_ITERATE_NEXT	0x04	/* Next iteration configuration */
 #define	WT_CBT_ITERATE_PREV	0x08	/* Prev iteration configuration */
 #define	WT_CBT_MAX_RECORD	0x10	/* Col-store: past end-of-table */
-#define	WT_CBT_SEARCH_SMALLEST	0x20	/* Row-store: small-key insert list */
+#define	WT_CBT_SCAN		0x20	/* Cursor configured for scans */
+#define	WT_CBT_SEARCH_SMALLEST	0x40	/* Row-store: small-key insert list */
 	uint8_t flags;
 };
 
@@ -39,7 +39,8 @@ __cursor_search_clear(WT_CURSOR_BTREE *cbt)
 	cbt->cip_saved = NULL;
 	cbt->rip_saved = NULL;
 
-	F_CLR(cbt, ~WT_CBT_ACTIVE);
+	/* Clear the position flags, the scan flag is configuration. */
+	F_CLR(cbt, ~(WT_CBT_ACTIVE | WT_CBT_SCAN));
 }
 
 /*
@@ -27,6 +27,38 @@ extern int __wt_block_ckpt_to_buffer(WT_SESSION_IMPL *session,
     WT_BLOCK *block,
     uint8_t **pp,
     WT_BLOCK_CKPT *ci);
+extern int __wt_block_aio_open(WT_SESSION_IMPL *session, WT_BLOCK *block);
+extern int __wt_block_aio_close(WT_SESSION_IMPL *session, WT_BLOCK *block);
+extern int __wt_block_aio_write(WT_SESSION_IMPL *session,
+    WT_BLOCK *block,
+    const void *mem,
+    off_t offset,
+    uint32_t size);
+extern int __wt_block_aio_wait( WT_SESSION_IMPL *session,
+    WT_BLOCK *block,
+    off_t offset,
+    uint32_t size);
+extern int __wt_block_aio_drain(WT_SESSION_IMPL *session, WT_BLOCK *block);
+extern int __wt_block_cache_create(WT_CONNECTION_IMPL *conn, const char *cfg[]);
+extern int __wt_block_cache_destroy(WT_CONNECTION_IMPL *conn);
+extern void __wt_block_cache_get(WT_SESSION_IMPL *session,
+    WT_BLOCK *block,
+    off_t offset,
+    uint32_t size,
+    uint32_t cksum,
+    WT_ITEM *buf,
+    int *foundp);
+extern void __wt_block_cache_put(WT_SESSION_IMPL *session,
+    WT_BLOCK *block,
+    off_t offset,
+    uint32_t size,
+    uint32_t cksum,
+    void *image,
+    size_t image_size);
+extern void __wt_block_cache_remove( WT_SESSION_IMPL *session,
+    WT_BLOCK *block,
+    off_t offset);
+extern void __wt_block_cache_discard(WT_SESSION_IMPL *session, WT_BLOCK *block);
 extern int __wt_block_ckpt_init( WT_SESSION_IMPL *session,
     WT_BLOCK_CKPT *ci,
     const char *name);
@@ -73,6 +105,13 @@ extern int __wt_block_alloc( WT_SESSION_IMPL *session,
     WT_BLOCK *block,
     off_t *offp,
     off_t size);
+extern int __wt_block_alloc_arena( WT_SESSION_IMPL *session,
+    WT_BLOCK *block,
+    off_t *offp,
+    off_t size);
+extern void __wt_block_arena_lock(WT_SESSION_IMPL *session, WT_BLOCK *block);
+extern void __wt_block_arena_unlock(WT_SESSION_IMPL *session, WT_BLOCK *block);
+extern int __wt_block_arena_discard(WT_SESSION_IMPL *session, WT_BLOCK *block);
 extern int __wt_block_free(WT_SESSION_IMPL *session,
     WT_BLOCK *block,
     const uint8_t *addr,
@@ -118,6 +157,14 @@ extern int __wt_block_map( WT_SESSION_IMPL *session,
     WT_BLOCK *block,
     void *mapp,
     size_t *maplenp);
+extern int __wt_block_map_open(WT_SESSION_IMPL *session, WT_BLOCK *block);
+extern int __wt_block_map_close(WT_SESSION_IMPL *session, WT_BLOCK *block);
+extern int __wt_block_map_read(WT_SESSION_IMPL *session,
+    WT_BLOCK *block,
+    void *buf,
+    off_t offset,
+    uint32_t size,
+    int *mappedp);
 extern int __wt_block_unmap( WT_SESSION_IMPL *session,
     WT_BLOCK *block,
     void *map,
@@ -229,6 +276,19 @@ extern int __wt_bloom_hash_get(WT_BLOOM *bloom, WT_BLOOM_HASH *bhash);
 extern int __wt_bloom_get(WT_BLOOM *bloom, WT_ITEM *key);
 extern int __wt_bloom_close(WT_BLOOM *bloom);
 extern int __wt_bloom_drop(WT_BLOOM *bloom, const char *config);
+extern int __wt_page_arena_alloc( WT_SESSION_IMPL *session,
+    WT_PAGE *page,
+    size_t size,
+    void *retp);
+extern void __wt_page_arena_free( WT_SESSION_IMPL *session,
+    WT_PAGE *page,
+    void *p,
+    size_t size);
+extern int __wt_page_arena_share( WT_SESSION_IMPL *session,
+    WT_PAGE *from,
+    WT_PAGE *to,
+    void *p);
+extern void __wt_page_arena_discard(WT_SESSION_IMPL *session, WT_PAGE *page);
 extern int __wt_bulk_init(WT_CURSOR_BULK *cbulk);
 extern int __wt_bulk_insert(WT_CURSOR_BULK *cbulk);
 extern int __wt_bulk_end(WT_CURSOR_BULK *cbulk);
@@ -278,6 +338,9 @@ extern void __wt_page_out(WT_SESSION_IMPL *session, WT_PAGE **pagep);
 extern void __wt_evict_list_clr_page(WT_SESSION_IMPL *session, WT_PAGE *page);
 extern int __wt_evict_server_wake(WT_SESSION_IMPL *session);
 extern void *__wt_cache_evict_server(void *arg);
+extern int __wt_evict_workers_open(WT_CONNECTION_IMPL *conn);
+extern int __wt_evict_create(WT_CONNECTION_IMPL *conn);
+extern int __wt_evict_destroy(WT_CONNECTION_IMPL *conn);
 extern void __wt_evict_clear_tree_walk(WT_SESSION_IMPL *session, WT_PAGE *page);
 extern int __wt_evict_page(WT_SESSION_IMPL *session, WT_PAGE *page);
 extern void __wt_evict_file_exclusive_on(WT_SESSION_IMPL *session);
@@ -348,9 +411,20 @@ extern int __wt_page_inmem( WT_SESSION_IMPL *session,
     WT_PAGE_HEADER *dsk,
     uint32_t flags,
     WT_PAGE **pagep);
+extern int __wt_prefetch_create(WT_CONNECTION_IMPL *conn, const char *cfg[]);
+extern int __wt_prefetch_destroy(WT_CONNECTION_IMPL *conn);
+extern int __wt_prefetch_queue(WT_SESSION_IMPL *session,
+    WT_PAGE *parent,
+    WT_REF *ref);
+extern int __wt_prefetch_range(WT_SESSION_IMPL *session,
+    WT_CURSOR_BTREE *start,
+    WT_CURSOR_BTREE *stop);
 extern int __wt_cache_read(WT_SESSION_IMPL *session,
     WT_PAGE *parent,
     WT_REF *ref);
+extern int __wt_cache_read_prefetch( WT_SESSION_IMPL *session,
+    WT_PAGE *parent,
+    WT_REF *ref);
 extern int __wt_row_key_get(WT_CURSOR_BTREE *cbt, WT_ITEM *key);
 extern int __wt_kv_return(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt);
 extern int __wt_bt_salvage(WT_SESSION_IMPL *session,
@@ -370,6 +444,11 @@ extern void __wt_tree_walk_delete_rollback(WT_REF *ref);
 extern int __wt_tree_walk(WT_SESSION_IMPL *session,
     WT_PAGE **pagep,
     uint32_t flags);
+extern int __wt_write_behind_create(WT_CONNECTION_IMPL *conn,
+    const char *cfg[]);
+extern int __wt_write_behind_destroy(WT_CONNECTION_IMPL *conn);
+extern int __wt_write_behind_wake(WT_SESSION_IMPL *session);
+extern int __wt_write_behind_bytes(WT_SESSION_IMPL *session, uint64_t bytes);
 extern int __wt_col_modify(WT_SESSION_IMPL *session,
     WT_CURSOR_BTREE *cbt,
     int is_remove);
@@ -446,11 +525,13 @@ extern int __wt_row_modify(WT_SESSION_IMPL *session,
     WT_CURSOR_BTREE *cbt,
     int is_remove);
 extern int __wt_row_insert_alloc(WT_SESSION_IMPL *session,
+    WT_PAGE *page,
     WT_ITEM *key,
     u_int skipdepth,
     WT_INSERT **insp,
     size_t *ins_sizep);
 extern int __wt_update_alloc(WT_SESSION_IMPL *session,
+    WT_PAGE *page,
     WT_ITEM *value,
     WT_UPDATE **updp,
     size_t *sizep);
@@ -695,6 +776,7 @@ extern int __wt_log_extract_lognum( WT_SESSION_IMPL *session,
     const char *name,
     uint32_t *id);
 extern int __wt_log_remove(WT_SESSION_IMPL *session, uint32_t lognum);
+extern int __wt_log_prealloc(WT_SESSION_IMPL *session);
 extern int __wt_log_open(WT_SESSION_IMPL *session);
 extern int __wt_log_close(WT_SESSION_IMPL *session);
 extern int __wt_log_newfile(WT_SESSION_IMPL *session, int conn_create);
@@ -990,6 +1072,20 @@ extern int __wt_turtle_update( WT_SESSION_IMPL *session,
     const char *key,
     const char *value);
 extern void __wt_abort(WT_SESSION_IMPL *session) WT_GCC_ATTRIBUTE((noreturn));
+extern int __wt_aio_open(WT_SESSION_IMPL *session, u_int depth, WT_AIO **aiop);
+extern int __wt_aio_close(WT_SESSION_IMPL *session, WT_AIO **aiop);
+extern int __wt_aio_write(WT_SESSION_IMPL *session,
+    WT_AIO *aio,
+    u_int slot,
+    WT_FH *fh,
+    off_t offset,
+    uint32_t bytes,
+    const void *buf);
+extern int __wt_aio_reap(WT_SESSION_IMPL *session,
+    WT_AIO *aio,
+    u_int min,
+    WT_AIO_EVENT *events,
+    u_int *countp);
 extern int __wt_calloc(WT_SESSION_IMPL *session,
     size_t number,
     size_t size,
@@ -1041,8 +1137,8 @@ extern int __wt_ftruncate(WT_SESSION_IMPL *session, WT_FH *fh, off_t len);
 extern int __wt_getline(WT_SESSION_IMPL *session, WT_ITEM *buf, FILE *fp);
 extern int __wt_mmap(WT_SESSION_IMPL *session,
     WT_FH *fh,
-    void *mapp,
-    size_t *lenp);
+    size_t len,
+    void *mapp);
 extern int __wt_mmap_preload(WT_SESSION_IMPL *session, void *p, size_t size);
 extern int __wt_mmap_discard(WT_SESSION_IMPL *session, void *p, size_t size);
 extern int __wt_munmap(WT_SESSION_IMPL *session,
@@ -1478,6 +1574,9 @@ extern void *__wt_ext_scr_alloc( WT_EXTENSION_API *wt_api,
 extern void __wt_ext_scr_free(WT_EXTENSION_API *wt_api,
     WT_SESSION *wt_session,
     void *p);
+extern int __wt_buf_pool_create(WT_CONNECTION_IMPL *conn, const char *cfg[]);
+extern int __wt_buf_pool_destroy(WT_CONNECTION_IMPL *conn);
+extern void __wt_buf_pool_free(WT_SESSION_IMPL *session, void *p, size_t size);
 extern void __wt_session_dump_all(WT_SESSION_IMPL *session);
 extern void __wt_session_dump(WT_SESSION_IMPL *session);
 extern void __wt_stat_init_dsrc_stats(WT_DSRC_STATS *stats);
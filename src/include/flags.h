@@ -18,6 +18,7 @@
 #define	WT_LOGSCAN_RECOVER				0x00000001
 #define	WT_LOG_DSYNC					0x00000002
 #define	WT_LOG_FSYNC					0x00000001
+#define	WT_SESSION_CHECKPOINT				0x00000100
 #define	WT_SESSION_INTERNAL				0x00000080
 #define	WT_SESSION_LOGGING_DISABLED			0x00000040
 #define	WT_SESSION_LOGGING_INMEM			0x00000020
@@ -32,10 +33,11 @@
 #define	WT_SYNC_DISCARD					0x00000004
 #define	WT_SYNC_DISCARD_NOWRITE				0x00000002
 #define	WT_SYNC_WRITE_LEAVES				0x00000001
-#define	WT_TREE_CACHE					0x00000080
-#define	WT_TREE_COMPACT					0x00000040
-#define	WT_TREE_DISCARD					0x00000020
-#define	WT_TREE_EVICT					0x00000010
+#define	WT_TREE_CACHE					0x00000100
+#define	WT_TREE_COMPACT					0x00000080
+#define	WT_TREE_DISCARD					0x00000040
+#define	WT_TREE_EVICT					0x00000020
+#define	WT_TREE_PREFETCH				0x00000010
 #define	WT_TREE_PREV					0x00000008
 #define	WT_TREE_SKIP_INTL				0x00000004
 #define	WT_TREE_SKIP_LEAF				0x00000002
@@ -6,10 +6,13 @@
  */
 
 #define	WT_LOG_FILENAME	"WiredTigerLog"		/* Log file name */
+#define	WT_LOG_PREPNAME	"WiredTigerPreplog"	/* Pre-allocated log file */
+#define	WT_LOG_TMPNAME	"WiredTigerTmplog"	/* Log file being prepared */
 
 /* Logging subsystem declarations. */
 #define	LOG_ALIGN		128
 #define	WT_LOG_SLOT_BUF_INIT_SIZE	64 * 1024
+#define	WT_LOG_SCAN_READ_AHEAD	(1024 * 1024)	/* Log scan read size */
 
 /*
  * We rely on this structure being aligned at 64 bits by the compiler,
@@ -90,6 +93,7 @@ typedef struct {
 	 * Log file information
 	 */
 	uint32_t	 fileid;	/* Current log file number */
+	uint32_t	 prep_fileid;	/* Last pre-allocated file number */
 	WT_FH           *log_fh;	/* Logging file handle */
 	WT_FH           *log_close_fh;	/* Logging file handle to close */
 
@@ -100,6 +104,7 @@ typedef struct {
 	WT_LSN		ckpt_lsn;	/* Last checkpoint LSN */
 	WT_LSN		first_lsn;	/* First LSN */
 	WT_LSN		sync_lsn;	/* LSN of the last sync */
+	WT_LSN		sync_req_lsn;	/* LSN the log flush thread must sync */
 	WT_LSN		trunc_lsn;	/* End LSN for recovery truncation */
 	WT_LSN		write_lsn;	/* Last LSN written to log file */
 
@@ -108,9 +113,13 @@ typedef struct {
 	 */
 	WT_SPINLOCK      log_lock;      /* Locked: Logging fields */
 	WT_SPINLOCK      log_slot_lock; /* Locked: Consolidation array */
+	WT_SPINLOCK      log_sync_lock; /* Locked: Log file syncs */
 
 	/* Notify any waiting slots when write_lsn is updated. */
 	WT_CONDVAR	*log_release_cond;
+	/* Notify any waiting commits when sync_lsn is updated. */
+	WT_CONDVAR	*log_sync_cond;
+	int		 sync_error;	/* Error writing or syncing the log */
 
 	/*
 	 * Consolidation array information
@@ -132,10 +141,21 @@ typedef struct {
 typedef struct {
 	uint32_t	len;		/* 00-03: Record length including hdr */
 	uint32_t	checksum;	/* 04-07: Checksum of the record */
-	uint8_t		unused[8];	/* 08-15: Padding */
+
+#define	WT_LOG_RECORD_COMPRESSED	0x01	/* Compressed except hdr */
+	uint16_t	flags;		/* 08-09: Flags */
+	uint8_t		unused[2];	/* 10-11: Padding */
+	uint32_t	mem_len;	/* 12-15: Uncompressed len if needed */
 	uint8_t		record[0];	/* Beginning of actual data */
 } WT_LOG_RECORD;
 
+/*
+ * WT_LOG_COMPRESS_SKIP --
+ *	The log record header isn't compressed: it holds the length, checksum
+ * and flags needed to read the record.
+ */
+#define	WT_LOG_COMPRESS_SKIP	(offsetof(WT_LOG_RECORD, record))
+
 /*
  * WT_LOG_DESC --
  *	The log file's description.
@@ -145,7 +165,7 @@ struct __wt_log_desc {
 	uint32_t	log_magic;	/* 00-03: Magic number */
 #define	WT_LOG_MAJOR_VERSION	1
 	uint16_t	majorv;		/* 04-05: Major version */
-#define	WT_LOG_MINOR_VERSION	0
+#define	WT_LOG_MINOR_VERSION	1
 	uint16_t	minorv;		/* 06-07: Minor version */
 	uint64_t	log_size;	/* 08-15: Log file size */
 };
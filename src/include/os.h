@@ -55,3 +55,25 @@ struct __wt_fh {
 
 	int	direct_io;			/* O_DIRECT configured */
 };
+
+/*
+ * WT_AIO --
+ *	An asynchronous I/O context: a fixed number of request slots, each of
+ * which can hold a single write in flight.
+ */
+struct __wt_aio {
+	uint64_t ctx;				/* Kernel AIO context */
+	u_int	 depth;				/* Request slots */
+	void	*iocb;				/* Request control blocks */
+	void	*events;			/* Completion events */
+};
+
+/*
+ * WT_AIO_EVENT --
+ *	A completed asynchronous write: the result is the number of bytes
+ * written, or a negated error number.
+ */
+struct __wt_aio_event {
+	u_int	slot;				/* Request slot */
+	int64_t	result;				/* Request result */
+};
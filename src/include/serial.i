@@ -17,11 +17,41 @@ __page_write_gen_wrapped_check(WT_PAGE *page)
 }
 
 /*
- * __insert_serial_func --
- *	Worker function to add a WT_INSERT entry to a skiplist.
+ * __insert_simple_func --
+ *	Worker function to add a WT_INSERT entry to the middle of a skiplist,
+ * without locking.
+ */
+static inline int
+__insert_simple_func(WT_SESSION_IMPL *session,
+    WT_INSERT ***ins_stack, WT_INSERT *new_ins, u_int skipdepth)
+{
+	u_int i;
+
+	WT_UNUSED(session);
+
+	/*
+	 * Swap the new item into each level, bottom-up, in place of the item
+	 * the search found following it.  If we race at level 0, nothing has
+	 * been changed, retry.  If we race at a higher level, the item is in
+	 * the list and the levels we updated are correct: stop, the item is
+	 * linked into fewer levels than planned, which is only slower.
+	 *
+	 * The swap is a full barrier, flushing the new item's contents before
+	 * it's visible to other threads.
+	 */
+	for (i = 0; i < skipdepth; i++)
+		if (!WT_ATOMIC_CAS(*ins_stack[i], new_ins->next[i], new_ins))
+			return (i == 0 ? WT_RESTART : 0);
+	return (0);
+}
+
+/*
+ * __insert_tail_func --
+ *	Worker function to add a WT_INSERT entry to a skiplist, including at
+ * the end of one or more levels; called with the page's spinlock held.
  */
 static inline int
-__insert_serial_func(WT_SESSION_IMPL *session,
+__insert_tail_func(WT_SESSION_IMPL *session,
     WT_INSERT_HEAD *ins_head, WT_INSERT ***ins_stack, WT_INSERT *new_ins,
     u_int skipdepth)
 {
@@ -49,17 +79,102 @@ __insert_serial_func(WT_SESSION_IMPL *session,
 			return (WT_RESTART);
 	}
 
-	/* Update the skiplist elements referencing the new WT_INSERT item. */
+	/*
+	 * Update the skiplist elements referencing the new WT_INSERT item.
+	 * Threads inserting in the middle of the list don't lock the page, we
+	 * can race with them at levels where we aren't appending: swap the
+	 * item into place the same way they do, and only update the tail of
+	 * levels the item was added to.
+	 */
 	for (i = 0; i < skipdepth; i++) {
+		if (!WT_ATOMIC_CAS(*ins_stack[i], new_ins->next[i], new_ins))
+			return (i == 0 ? WT_RESTART : 0);
 		if (ins_head->tail[i] == NULL ||
 		    ins_stack[i] == &ins_head->tail[i]->next[i])
 			ins_head->tail[i] = new_ins;
-		*ins_stack[i] = new_ins;
 	}
 
 	return (0);
 }
 
+/*
+ * __insert_append_retarget --
+ *	An append raced with another appending thread: if the new item still
+ * sorts after the list's last item, point the search stack at the end of the
+ * list.
+ */
+static inline int
+__insert_append_retarget(WT_SESSION_IMPL *session,
+    WT_INSERT_HEAD *ins_head, WT_INSERT ***ins_stack, WT_INSERT *new_ins,
+    u_int skipdepth)
+{
+	WT_INSERT *last_ins;
+	WT_ITEM insert_key, last_key;
+	u_int i;
+
+	/*
+	 * Only row-store keys can be compared here, and we don't call out to
+	 * an application's collator holding the page's spinlock.
+	 */
+	if (S2BT(session)->type != BTREE_ROW || S2BT(session)->collator != NULL)
+		return (WT_RESTART);
+	for (i = 0; i < skipdepth; i++)
+		if (new_ins->next[i] != NULL)
+			return (WT_RESTART);
+	if ((last_ins = WT_SKIP_LAST(ins_head)) == NULL)
+		return (WT_RESTART);
+
+	insert_key.data = WT_INSERT_KEY(new_ins);
+	insert_key.size = WT_INSERT_KEY_SIZE(new_ins);
+	last_key.data = WT_INSERT_KEY(last_ins);
+	last_key.size = WT_INSERT_KEY_SIZE(last_ins);
+	if (__wt_lex_compare(&insert_key, &last_key) <= 0)
+		return (WT_RESTART);
+
+	/* Set every level, the cursor keeps the stack as its finger. */
+	for (i = 0; i < WT_SKIP_MAXDEPTH; i++)
+		ins_stack[i] = ins_head->tail[i] == NULL ?
+		    &ins_head->head[i] : &ins_head->tail[i]->next[i];
+	WT_STAT_FAST_CONN_INCR(session, cursor_insert_append_race);
+	return (0);
+}
+
+/*
+ * __insert_serial_func --
+ *	Worker function to add a WT_INSERT entry to a skiplist.
+ */
+static inline int
+__insert_serial_func(WT_SESSION_IMPL *session, WT_PAGE *page,
+    WT_INSERT_HEAD *ins_head, WT_INSERT ***ins_stack, WT_INSERT *new_ins,
+    u_int skipdepth)
+{
+	WT_DECL_RET;
+	u_int i;
+
+	/*
+	 * Items added to the middle of every level of the list are swapped in
+	 * without locking.  Items added to the end of any level update the
+	 * list's tail, those updates are serialized by the page's spinlock.
+	 * See the comment at WT_INSERT_HEAD for the complete protocol.
+	 */
+	for (i = 0; i < skipdepth; i++)
+		if (ins_stack[i] == NULL || new_ins->next[i] == NULL)
+			break;
+	if (i == skipdepth)
+		return (__insert_simple_func(
+		    session, ins_stack, new_ins, skipdepth));
+
+	WT_PAGE_LOCK(session, page);
+	if ((ret = __insert_tail_func(session,
+	    ins_head, ins_stack, new_ins, skipdepth)) == WT_RESTART &&
+	    (ret = __insert_append_retarget(session,
+	    ins_head, ins_stack, new_ins, skipdepth)) == 0)
+		ret = __insert_tail_func(
+		    session, ins_head, ins_stack, new_ins, skipdepth);
+	WT_PAGE_UNLOCK(session, page);
+	return (ret);
+}
+
 /*
  * __col_append_serial_func --
  *	Worker function to allocate a record number as necessary, then add a
@@ -90,7 +205,7 @@ __col_append_serial_func(WT_SESSION_IMPL *session,
 	}
 
 	/* Confirm position and insert the new WT_INSERT item. */
-	WT_RET(__insert_serial_func(
+	WT_RET(__insert_tail_func(
 	    session, ins_head, ins_stack, new_ins, skipdepth));
 
 	/*
@@ -151,14 +266,16 @@ static inline int
 __wt_col_append_serial(
 	WT_SESSION_IMPL *session, WT_PAGE *page, WT_INSERT_HEAD *ins_head,
 	WT_INSERT ***ins_stack, WT_INSERT **new_insp, size_t new_ins_size,
-	uint64_t *recnop, u_int skipdepth)
+	WT_UPDATE **new_updp, size_t new_upd_size, uint64_t *recnop,
+	u_int skipdepth)
 {
 	WT_INSERT *new_ins = *new_insp;
+	WT_UPDATE *new_upd = *new_updp;
 	WT_DECL_RET;
-	size_t incr_mem;
 
 	/* Clear references to memory we now own. */
 	*new_insp = NULL;
+	*new_updp = NULL;
 
 	/*
 	 * Check to see if the page's write generation is about to wrap (wildly
@@ -182,24 +299,12 @@ __wt_col_append_serial(
 
 	/* Free unused memory on error. */
 	if (ret != 0) {
-		__wt_free(session, new_ins);
+		__wt_page_arena_free(session, page, new_ins, new_ins_size);
+		__wt_page_arena_free(session, page, new_upd, new_upd_size);
 
 		return (ret);
 	}
 
-	/*
-	 * Increment in-memory footprint after releasing the mutex: that's safe
-	 * because the structures we added cannot be discarded while visible to
-	 * any running transaction, and we're a running transaction, which means
-	 * there can be no corresponding delete until we complete.
-	 */
-	incr_mem = 0;
-	WT_ASSERT(session, new_ins_size != 0);
-	incr_mem += new_ins_size;
-	if (incr_mem != 0)
-		__wt_cache_page_inmem_incr(session, page, incr_mem);
-
-	/* Mark the page dirty after updating the footprint. */
 	__wt_page_modify_set(session, page);
 
 	return (0);
@@ -209,14 +314,15 @@ static inline int
 __wt_insert_serial(
 	WT_SESSION_IMPL *session, WT_PAGE *page, WT_INSERT_HEAD *ins_head,
 	WT_INSERT ***ins_stack, WT_INSERT **new_insp, size_t new_ins_size,
-	u_int skipdepth)
+	WT_UPDATE **new_updp, size_t new_upd_size, u_int skipdepth)
 {
 	WT_INSERT *new_ins = *new_insp;
+	WT_UPDATE *new_upd = *new_updp;
 	WT_DECL_RET;
-	size_t incr_mem;
 
 	/* Clear references to memory we now own. */
 	*new_insp = NULL;
+	*new_updp = NULL;
 
 	/*
 	 * Check to see if the page's write generation is about to wrap (wildly
@@ -232,32 +338,17 @@ __wt_insert_serial(
 	 */
 	 WT_RET(__page_write_gen_wrapped_check(page));
 
-	/* Acquire the page's spinlock, call the worker function. */
-	WT_PAGE_LOCK(session, page);
 	ret = __insert_serial_func(
-	    session, ins_head, ins_stack, new_ins, skipdepth);
-	WT_PAGE_UNLOCK(session, page);
+	    session, page, ins_head, ins_stack, new_ins, skipdepth);
 
 	/* Free unused memory on error. */
 	if (ret != 0) {
-		__wt_free(session, new_ins);
+		__wt_page_arena_free(session, page, new_ins, new_ins_size);
+		__wt_page_arena_free(session, page, new_upd, new_upd_size);
 
 		return (ret);
 	}
 
-	/*
-	 * Increment in-memory footprint after releasing the mutex: that's safe
-	 * because the structures we added cannot be discarded while visible to
-	 * any running transaction, and we're a running transaction, which means
-	 * there can be no corresponding delete until we complete.
-	 */
-	incr_mem = 0;
-	WT_ASSERT(session, new_ins_size != 0);
-	incr_mem += new_ins_size;
-	if (incr_mem != 0)
-		__wt_cache_page_inmem_incr(session, page, incr_mem);
-
-	/* Mark the page dirty after updating the footprint. */
 	__wt_page_modify_set(session, page);
 
 	return (0);
@@ -270,7 +361,6 @@ __wt_update_serial(
 {
 	WT_UPDATE *upd = *updp;
 	WT_DECL_RET;
-	size_t incr_mem;
 
 	/* Clear references to memory we now own. */
 	*updp = NULL;
@@ -294,24 +384,11 @@ __wt_update_serial(
 
 	/* Free unused memory on error. */
 	if (ret != 0) {
-		__wt_free(session, upd);
+		__wt_page_arena_free(session, page, upd, upd_size);
 
 		return (ret);
 	}
 
-	/*
-	 * Increment in-memory footprint after releasing the mutex: that's safe
-	 * because the structures we added cannot be discarded while visible to
-	 * any running transaction, and we're a running transaction, which means
-	 * there can be no corresponding delete until we complete.
-	 */
-	incr_mem = 0;
-	WT_ASSERT(session, upd_size != 0);
-	incr_mem += upd_size;
-	if (incr_mem != 0)
-		__wt_cache_page_inmem_incr(session, page, incr_mem);
-
-	/* Mark the page dirty after updating the footprint. */
 	__wt_page_modify_set(session, page);
 
 	return (0);
@@ -113,6 +113,12 @@ struct __wt_session_impl {
 	void	*reconcile;		/* Reconciliation support */
 	int	(*reconcile_cleanup)(WT_SESSION_IMPL *);
 
+					/* Cursor scan read-ahead state */
+	WT_PAGE *read_ahead_page;	/* Parent page of the last read */
+	uint32_t read_ahead_slot;	/* Slot of the last read */
+	uint32_t read_ahead_issued;	/* Furthest slot scheduled */
+	uint32_t read_ahead_window;	/* Current read-ahead window */
+
 	int compaction;			/* Compaction did some work */
 	int skip_schema_lock;		/* Another thread holds the schema lock
 					 * on our behalf */
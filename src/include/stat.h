@@ -120,15 +120,35 @@ struct __wt_connection_stats {
 	WT_STATS block_byte_map_read;
 	WT_STATS block_byte_read;
 	WT_STATS block_byte_write;
+	WT_STATS block_cache_bytes;
+	WT_STATS block_cache_evict;
+	WT_STATS block_cache_hit;
+	WT_STATS block_cache_insert;
+	WT_STATS block_cache_miss;
+	WT_STATS block_ckpt_throttle;
+	WT_STATS block_ckpt_throttle_time;
 	WT_STATS block_map_read;
 	WT_STATS block_preload;
 	WT_STATS block_read;
+	WT_STATS block_remap;
 	WT_STATS block_write;
+	WT_STATS block_write_async;
+	WT_STATS block_write_async_wait;
+	WT_STATS buffer_pool_alloc;
+	WT_STATS buffer_pool_bytes;
+	WT_STATS buffer_pool_reuse;
+	WT_STATS cache_arena_chunk;
+	WT_STATS cache_arena_reuse;
+	WT_STATS cache_bytes_clean_eviction;
+	WT_STATS cache_bytes_clean_write_behind;
 	WT_STATS cache_bytes_dirty;
 	WT_STATS cache_bytes_inuse;
 	WT_STATS cache_bytes_max;
+	WT_STATS cache_bytes_probation;
+	WT_STATS cache_bytes_protected;
 	WT_STATS cache_bytes_read;
 	WT_STATS cache_bytes_write;
+	WT_STATS cache_eviction_app;
 	WT_STATS cache_eviction_checkpoint;
 	WT_STATS cache_eviction_clean;
 	WT_STATS cache_eviction_dirty;
@@ -140,16 +160,32 @@ struct __wt_connection_stats {
 	WT_STATS cache_eviction_merge;
 	WT_STATS cache_eviction_merge_fail;
 	WT_STATS cache_eviction_merge_levels;
+	WT_STATS cache_eviction_server_evicting;
 	WT_STATS cache_eviction_slow;
 	WT_STATS cache_eviction_walk;
+	WT_STATS cache_eviction_worker_evicting;
+	WT_STATS cache_eviction_worker_evicting_max;
+	WT_STATS cache_eviction_worker_evicting_min;
+	WT_STATS cache_eviction_workers;
 	WT_STATS cache_inmem_split;
+	WT_STATS cache_leaf_hash;
 	WT_STATS cache_pages_dirty;
 	WT_STATS cache_pages_inuse;
+	WT_STATS cache_pages_protected;
+	WT_STATS cache_prefetch_queued;
+	WT_STATS cache_prefetch_read;
+	WT_STATS cache_prefetch_skipped;
+	WT_STATS cache_prefetch_used;
 	WT_STATS cache_read;
+	WT_STATS cache_read_ahead;
 	WT_STATS cache_write;
+	WT_STATS cache_write_behind;
 	WT_STATS cond_wait;
 	WT_STATS cursor_create;
 	WT_STATS cursor_insert;
+	WT_STATS cursor_insert_append_race;
+	WT_STATS cursor_insert_finger;
+	WT_STATS cursor_insert_restart;
 	WT_STATS cursor_next;
 	WT_STATS cursor_prev;
 	WT_STATS cursor_remove;
@@ -167,7 +203,15 @@ struct __wt_connection_stats {
 	WT_STATS log_buffer_size;
 	WT_STATS log_bytes_user;
 	WT_STATS log_bytes_written;
+	WT_STATS log_compress_len;
+	WT_STATS log_compress_mem;
+	WT_STATS log_compress_small;
+	WT_STATS log_compress_write_fails;
+	WT_STATS log_compress_writes;
 	WT_STATS log_max_filesize;
+	WT_STATS log_prealloc_files;
+	WT_STATS log_prealloc_missed;
+	WT_STATS log_prealloc_used;
 	WT_STATS log_reads;
 	WT_STATS log_scan_records;
 	WT_STATS log_scan_rereads;
@@ -197,10 +241,17 @@ struct __wt_connection_stats {
 	WT_STATS session_cursor_open;
 	WT_STATS txn_begin;
 	WT_STATS txn_checkpoint;
+	WT_STATS txn_checkpoint_incremental_bytes;
+	WT_STATS txn_checkpoint_incremental_pages;
 	WT_STATS txn_checkpoint_running;
 	WT_STATS txn_commit;
 	WT_STATS txn_fail_cache;
+	WT_STATS txn_recover_file;
+	WT_STATS txn_recover_ops;
 	WT_STATS txn_rollback;
+	WT_STATS txn_snapshot_states;
+	WT_STATS txn_snapshot_time;
+	WT_STATS txn_snapshots;
 	WT_STATS write_io;
 };
 
@@ -255,6 +306,7 @@ struct __wt_dsrc_stats {
 	WT_STATS cache_inmem_split;
 	WT_STATS cache_overflow_value;
 	WT_STATS cache_read;
+	WT_STATS cache_read_ahead;
 	WT_STATS cache_read_overflow;
 	WT_STATS cache_write;
 	WT_STATS compress_raw_fail;
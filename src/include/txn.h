@@ -42,6 +42,12 @@ struct __wt_txn_global {
 	volatile int32_t scan_count;
 
 	WT_TXN_STATE *states;		/* Per-session transaction states */
+
+	/*
+	 * Bitmap of the sessions that may have an ID or snap_min published in
+	 * their transaction state: scans skip idle sessions a word at a time.
+	 */
+	volatile uint64_t *active;
 };
 
 enum __wt_txn_isolation {
@@ -129,6 +135,7 @@ struct __wt_txn {
 #define	TXN_ERROR	0x02
 #define	TXN_OLDEST	0x04
 #define	TXN_RUNNING	0x08
+#define	TXN_STATE_ACTIVE	0x10
 	uint32_t flags;
 };
 
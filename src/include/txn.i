@@ -8,6 +8,86 @@
 static inline void __wt_txn_read_first(WT_SESSION_IMPL *session);
 static inline void __wt_txn_read_last(WT_SESSION_IMPL *session);
 
+/*
+ * __wt_txn_state_active --
+ *	Mark the session's transaction state active, before publishing an ID
+ * or snap_min in it.
+ */
+static inline void
+__wt_txn_state_active(WT_SESSION_IMPL *session)
+{
+	WT_TXN *txn;
+	volatile uint64_t *wordp;
+	uint64_t bit, word;
+
+	txn = &session->txn;
+	if (F_ISSET(txn, TXN_STATE_ACTIVE))
+		return;
+	F_SET(txn, TXN_STATE_ACTIVE);
+
+	wordp = &S2C(session)->txn_global.active[session->id / 64];
+	bit = (uint64_t)1 << (session->id % 64);
+	do {
+		word = *wordp;
+	} while (!WT_ATOMIC_CAS(*wordp, word, word | bit));
+}
+
+/*
+ * __wt_txn_state_idle --
+ *	Mark the session's transaction state idle, once neither an ID nor a
+ * snap_min is published in it.
+ */
+static inline void
+__wt_txn_state_idle(WT_SESSION_IMPL *session)
+{
+	WT_TXN *txn;
+	WT_TXN_STATE *txn_state;
+	volatile uint64_t *wordp;
+	uint64_t bit, word;
+
+	txn = &session->txn;
+	if (!F_ISSET(txn, TXN_STATE_ACTIVE))
+		return;
+
+	txn_state = &S2C(session)->txn_global.states[session->id];
+	if (txn_state->id != WT_TXN_NONE || txn_state->snap_min != WT_TXN_NONE)
+		return;
+	F_CLR(txn, TXN_STATE_ACTIVE);
+
+	wordp = &S2C(session)->txn_global.active[session->id / 64];
+	bit = (uint64_t)1 << (session->id % 64);
+	do {
+		word = *wordp;
+	} while (!WT_ATOMIC_CAS(*wordp, word, word & ~bit));
+}
+
+/*
+ * __wt_txn_state_next --
+ *	Return the next active transaction state, starting from a session slot.
+ */
+static inline WT_TXN_STATE *
+__wt_txn_state_next(
+    WT_TXN_GLOBAL *txn_global, uint32_t session_cnt, uint32_t *slotp)
+{
+	uint64_t word;
+	uint32_t i;
+
+	for (i = *slotp; i < session_cnt;) {
+		if ((word = txn_global->active[i / 64] >> (i % 64)) == 0) {
+			i = (i / 64 + 1) * 64;
+			continue;
+		}
+		for (; (word & 1) == 0; word >>= 1)
+			++i;
+		if (i >= session_cnt)
+			break;
+		*slotp = i + 1;
+		return (&txn_global->states[i]);
+	}
+	*slotp = session_cnt;
+	return (NULL);
+}
+
 /*
  * __wt_txn_modify --
  *	Mark a WT_UPDATE object modified by the current transaction.
@@ -314,8 +394,10 @@ __wt_txn_cursor_op(WT_SESSION_IMPL *session)
 	 */
 	if (txn->isolation == TXN_ISO_READ_UNCOMMITTED &&
 	    !F_ISSET(txn, TXN_RUNNING) &&
-	    TXNID_LT(txn_state->snap_min, txn_global->last_running))
+	    TXNID_LT(txn_state->snap_min, txn_global->last_running)) {
+		__wt_txn_state_active(session);
 		txn_state->snap_min = txn_global->last_running;
+	}
 }
 
 /*
@@ -330,7 +412,7 @@ __wt_txn_am_oldest(WT_SESSION_IMPL *session)
 	WT_TXN_GLOBAL *txn_global;
 	WT_TXN_STATE *s;
 	uint64_t id, my_id;
-	uint32_t i, session_cnt;
+	uint32_t slot, session_cnt;
 
 	/* Cache the result: if we're the oldest, don't keep checking. */
 	txn = &session->txn;
@@ -349,9 +431,8 @@ __wt_txn_am_oldest(WT_SESSION_IMPL *session)
 		return (0);
 
 	WT_ORDERED_READ(session_cnt, conn->session_cnt);
-	for (i = 0, s = txn_global->states;
-	    i < session_cnt;
-	    i++, s++)
+	for (slot = 0;
+	    (s = __wt_txn_state_next(txn_global, session_cnt, &slot)) != NULL;)
 		if ((id = s->id) != WT_TXN_NONE && TXNID_LT(id, my_id))
 			return (0);
 
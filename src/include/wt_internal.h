@@ -37,6 +37,9 @@ extern "C" {
 #include <stdlib.h>
 #include <string.h>
 #include <unistd.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
 
 /*******************************************
  * WiredTiger externally maintained include files.
@@ -51,8 +54,20 @@ typedef enum __wt_page_state WT_PAGE_STATE;
 typedef enum __wt_txn_isolation WT_TXN_ISOLATION;
 struct __wt_addr;
     typedef struct __wt_addr WT_ADDR;
+struct __wt_aio;
+    typedef struct __wt_aio WT_AIO;
+struct __wt_aio_event;
+    typedef struct __wt_aio_event WT_AIO_EVENT;
 struct __wt_block;
     typedef struct __wt_block WT_BLOCK;
+struct __wt_block_aio;
+    typedef struct __wt_block_aio WT_BLOCK_AIO;
+struct __wt_block_arena;
+    typedef struct __wt_block_arena WT_BLOCK_ARENA;
+struct __wt_block_cache;
+    typedef struct __wt_block_cache WT_BLOCK_CACHE;
+struct __wt_block_cache_entry;
+    typedef struct __wt_block_cache_entry WT_BLOCK_CACHE_ENTRY;
 struct __wt_block_ckpt;
     typedef struct __wt_block_ckpt WT_BLOCK_CKPT;
 struct __wt_block_desc;
@@ -67,6 +82,8 @@ struct __wt_bm;
     typedef struct __wt_bm WT_BM;
 struct __wt_btree;
     typedef struct __wt_btree WT_BTREE;
+struct __wt_buf_pool;
+    typedef struct __wt_buf_pool WT_BUF_POOL;
 struct __wt_cache;
     typedef struct __wt_cache WT_CACHE;
 struct __wt_cache_pool;
@@ -131,6 +148,10 @@ struct __wt_dsrc_stats;
     typedef struct __wt_dsrc_stats WT_DSRC_STATS;
 struct __wt_evict_entry;
     typedef struct __wt_evict_entry WT_EVICT_ENTRY;
+struct __wt_evict_part;
+    typedef struct __wt_evict_part WT_EVICT_PART;
+struct __wt_evict_worker;
+    typedef struct __wt_evict_worker WT_EVICT_WORKER;
 struct __wt_ext;
     typedef struct __wt_ext WT_EXT;
 struct __wt_extlist;
@@ -181,16 +202,28 @@ struct __wt_ovfl_txnc;
     typedef struct __wt_ovfl_txnc WT_OVFL_TXNC;
 struct __wt_page;
     typedef struct __wt_page WT_PAGE;
+struct __wt_page_arena;
+    typedef struct __wt_page_arena WT_PAGE_ARENA;
+struct __wt_page_arena_chunk;
+    typedef struct __wt_page_arena_chunk WT_PAGE_ARENA_CHUNK;
+struct __wt_page_arena_large;
+    typedef struct __wt_page_arena_large WT_PAGE_ARENA_LARGE;
+struct __wt_page_arena_ref;
+    typedef struct __wt_page_arena_ref WT_PAGE_ARENA_REF;
 struct __wt_page_header;
     typedef struct __wt_page_header WT_PAGE_HEADER;
 struct __wt_page_modify;
     typedef struct __wt_page_modify WT_PAGE_MODIFY;
+struct __wt_prefetch_entry;
+    typedef struct __wt_prefetch_entry WT_PREFETCH_ENTRY;
 struct __wt_process;
     typedef struct __wt_process WT_PROCESS;
 struct __wt_ref;
     typedef struct __wt_ref WT_REF;
 struct __wt_row;
     typedef struct __wt_row WT_ROW;
+struct __wt_row_hash;
+    typedef struct __wt_row_hash WT_ROW_HASH;
 struct __wt_rwlock;
     typedef struct __wt_rwlock WT_RWLOCK;
 struct __wt_salvage_cookie;
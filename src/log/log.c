@@ -102,11 +102,13 @@ __wt_log_files_free(WT_SESSION_IMPL *session, char **files, u_int count)
 }
 
 /*
- * __wt_log_filename --
- *	Given a log number, return a WT_ITEM of a generated log file name.
+ * __log_filename --
+ *	Given a log number and file name prefix, return a WT_ITEM of a
+ *	generated log file name.
  */
-int
-__wt_log_filename(WT_SESSION_IMPL *session, uint32_t id, WT_ITEM *buf)
+static int
+__log_filename(WT_SESSION_IMPL *session,
+    uint32_t id, const char *file_prefix, WT_ITEM *buf)
 {
 	const char *log_path;
 
@@ -114,14 +116,24 @@ __wt_log_filename(WT_SESSION_IMPL *session, uint32_t id, WT_ITEM *buf)
 
 	if (log_path != NULL && log_path[0] != '\0')
 		WT_RET(__wt_buf_fmt(session, buf, "%s/%s.%010" PRIu32,
-		    log_path, WT_LOG_FILENAME, id));
+		    log_path, file_prefix, id));
 	else
 		WT_RET(__wt_buf_fmt(session, buf, "%s.%010" PRIu32,
-		    WT_LOG_FILENAME, id));
+		    file_prefix, id));
 
 	return (0);
 }
 
+/*
+ * __wt_log_filename --
+ *	Given a log number, return a WT_ITEM of a generated log file name.
+ */
+int
+__wt_log_filename(WT_SESSION_IMPL *session, uint32_t id, WT_ITEM *buf)
+{
+	return (__log_filename(session, id, WT_LOG_FILENAME, buf));
+}
+
 /*
  * __wt_log_extract_lognum --
  *	Given a log file name, extract out the log number.
@@ -161,6 +173,153 @@ err:	__wt_scr_free(&path);
 	return (ret);
 }
 
+/*
+ * __log_prep_setup --
+ *	Clean up pre-allocated log files left by a previous run: remove files
+ *	that were still being prepared, and prepared files if pre-allocation is
+ *	no longer configured.  Otherwise, remember the highest prepared file
+ *	number, so new files don't collide with existing ones.
+ */
+static int
+__log_prep_setup(WT_SESSION_IMPL *session)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_ITEM(path);
+	WT_DECL_RET;
+	WT_LOG *log;
+	uint32_t lognum;
+	u_int i, logcount;
+	char **logfiles;
+
+	conn = S2C(session);
+	log = conn->log;
+	logfiles = NULL;
+	logcount = 0;
+
+	WT_RET(__wt_scr_alloc(session, 0, &path));
+	WT_ERR(__wt_dirlist(session, conn->log_path,
+	    WT_LOG_TMPNAME, WT_DIRLIST_INCLUDE, &logfiles, &logcount));
+	for (i = 0; i < logcount; i++) {
+		WT_ERR(__wt_log_extract_lognum(session, logfiles[i], &lognum));
+		WT_ERR(__log_filename(session, lognum, WT_LOG_TMPNAME, path));
+		WT_ERR(__wt_remove(session, path->data));
+	}
+	__wt_log_files_free(session, logfiles, logcount);
+	logfiles = NULL;
+	logcount = 0;
+
+	WT_ERR(__wt_dirlist(session, conn->log_path,
+	    WT_LOG_PREPNAME, WT_DIRLIST_INCLUDE, &logfiles, &logcount));
+	for (i = 0; i < logcount; i++) {
+		WT_ERR(__wt_log_extract_lognum(session, logfiles[i], &lognum));
+		if (conn->log_prealloc == 0) {
+			WT_ERR(__log_filename(
+			    session, lognum, WT_LOG_PREPNAME, path));
+			WT_ERR(__wt_remove(session, path->data));
+		} else
+			log->prep_fileid = WT_MAX(log->prep_fileid, lognum);
+	}
+
+err:	if (logfiles != NULL)
+		__wt_log_files_free(session, logfiles, logcount);
+	__wt_scr_free(&path);
+	return (ret);
+}
+
+/*
+ * __log_alloc_prealloc --
+ *	Look for a pre-allocated log file and rename it to be the given log
+ *	file number.  Return WT_NOTFOUND if there isn't one.
+ */
+static int
+__log_alloc_prealloc(WT_SESSION_IMPL *session, uint32_t to_num)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_ITEM(from_path);
+	WT_DECL_ITEM(to_path);
+	WT_DECL_RET;
+	uint32_t from_num;
+	u_int logcount;
+	char **logfiles;
+
+	conn = S2C(session);
+	logfiles = NULL;
+	logcount = 0;
+
+	WT_RET(__wt_dirlist(session, conn->log_path,
+	    WT_LOG_PREPNAME, WT_DIRLIST_INCLUDE, &logfiles, &logcount));
+	if (logcount == 0) {
+		ret = WT_NOTFOUND;
+		goto err;
+	}
+
+	/* Any of the files will do, they're all the same. */
+	WT_ERR(__wt_log_extract_lognum(session, logfiles[0], &from_num));
+	WT_ERR(__wt_scr_alloc(session, 0, &from_path));
+	WT_ERR(__wt_scr_alloc(session, 0, &to_path));
+	WT_ERR(__log_filename(session, from_num, WT_LOG_PREPNAME, from_path));
+	WT_ERR(__wt_log_filename(session, to_num, to_path));
+	WT_VERBOSE_ERR(session, log, "log_alloc_prealloc: rename %s to %s",
+	    (char *)from_path->data, (char *)to_path->data);
+	WT_ERR(__wt_rename(session, from_path->data, to_path->data));
+
+	/* Tell the pre-allocation thread to replace the file we used. */
+	WT_ERR(__wt_cond_signal(session, conn->log_prealloc_cond));
+
+err:	if (logfiles != NULL)
+		__wt_log_files_free(session, logfiles, logcount);
+	__wt_scr_free(&from_path);
+	__wt_scr_free(&to_path);
+	return (ret);
+}
+
+/*
+ * __wt_log_prealloc --
+ *	Prepare a log file for later use: create it under a temporary name,
+ *	allocate its space and then rename it, so the log never switches to
+ *	a partially prepared file.
+ */
+int
+__wt_log_prealloc(WT_SESSION_IMPL *session)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_ITEM(from_path);
+	WT_DECL_ITEM(to_path);
+	WT_DECL_RET;
+	WT_FH *fh;
+	WT_LOG *log;
+	uint32_t id;
+
+	conn = S2C(session);
+	log = conn->log;
+	fh = NULL;
+
+	/* Only the log pre-allocation thread prepares files. */
+	id = ++log->prep_fileid;
+
+	WT_RET(__wt_scr_alloc(session, 0, &from_path));
+	WT_ERR(__wt_scr_alloc(session, 0, &to_path));
+	WT_ERR(__log_filename(session, id, WT_LOG_TMPNAME, from_path));
+	WT_ERR(__log_filename(session, id, WT_LOG_PREPNAME, to_path));
+
+	WT_ERR(__wt_open(
+	    session, from_path->data, 1, 1, WT_FILE_TYPE_LOG, &fh));
+	WT_ERR(__wt_fallocate(session, fh, 0, conn->log_file_max));
+	WT_ERR(__wt_fsync(session, fh));
+	ret = __wt_close(session, fh);
+	fh = NULL;
+	WT_ERR(ret);
+
+	WT_ERR(__wt_rename(session, from_path->data, to_path->data));
+	WT_STAT_FAST_CONN_INCR(session, log_prealloc_files);
+
+err:	if (fh != NULL)
+		WT_TRET(__wt_close(session, fh));
+	__wt_scr_free(&from_path);
+	__wt_scr_free(&to_path);
+	return (ret);
+}
+
 /*
  * __log_openfile --
  *	Open a log file with the given log file number and return the WT_FH.
@@ -215,6 +374,8 @@ __wt_log_open(WT_SESSION_IMPL *session)
 	log->first_lsn.file = firstlog;
 	log->first_lsn.offset = 0;
 
+	WT_ERR(__log_prep_setup(session));
+
 	/*
 	 * Start logging at the beginning of the next log file, no matter
 	 * where the previous log file ends.
@@ -453,9 +614,11 @@ __log_acquire(WT_SESSION_IMPL *session, uint64_t recsize, WT_LOGSLOT *slot)
 	slot->slot_start_lsn = log->alloc_lsn;
 	slot->slot_start_offset = log->alloc_lsn.offset;
 	/*
-	 * Pre-allocate on the first real write into the log file.
+	 * Pre-allocate on the first real write into the log file, unless the
+	 * log file was pre-allocated before we switched to it.
 	 */
-	if (log->alloc_lsn.offset == LOG_FIRST_RECORD)
+	if (log->alloc_lsn.offset == LOG_FIRST_RECORD &&
+	    log->log_fh->size < conn->log_file_max)
 		WT_RET(__wt_fallocate(session,
 		    log->log_fh, LOG_FIRST_RECORD, conn->log_file_max));
 	log->alloc_lsn.offset += (off_t)recsize;
@@ -516,11 +679,41 @@ __log_release(WT_SESSION_IMPL *session, WT_LOGSLOT *slot)
 			WT_STAT_FAST_CONN_INCR(session,
 			    log_slot_release_wait_timeout);
 	}
-	if (F_ISSET(slot, SLOT_SYNC)) {
+
+	/*
+	 * The log flush thread only syncs the current log file: if we're
+	 * switching files, sync the old one before any later write completes.
+	 */
+	if (close_fh != NULL && conn->log_flush_session != NULL) {
+		__wt_spin_lock(session, &log->log_sync_lock);
 		WT_STAT_FAST_CONN_INCR(session, log_sync);
-		WT_ERR(__wt_fsync(session, log->log_fh));
+		if ((ret = __wt_fsync(session, close_fh)) == 0 &&
+		    LOG_CMP(&slot->slot_release_lsn, &log->sync_lsn) > 0)
+			log->sync_lsn = slot->slot_release_lsn;
+		__wt_spin_unlock(session, &log->log_sync_lock);
+		WT_ERR(ret);
+		WT_ERR(__wt_cond_signal(session, log->log_sync_cond));
+	}
+
+	if (F_ISSET(slot, SLOT_SYNC)) {
+		if (conn->log_flush_session != NULL) {
+			/*
+			 * Leave the sync to the log flush thread, so it can be
+			 * shared by all of the commits waiting for one.
+			 */
+			__wt_spin_lock(session, &log->log_lock);
+			if (LOG_CMP(
+			    &slot->slot_end_lsn, &log->sync_req_lsn) > 0)
+				log->sync_req_lsn = slot->slot_end_lsn;
+			__wt_spin_unlock(session, &log->log_lock);
+			WT_ERR(__wt_cond_signal(session, conn->log_flush_cond));
+		} else {
+			WT_STAT_FAST_CONN_INCR(session, log_sync);
+			WT_ERR(__wt_fsync(session, log->log_fh));
+			log->sync_lsn = slot->slot_end_lsn;
+			WT_ERR(__wt_cond_signal(session, log->log_sync_cond));
+		}
 		F_CLR(slot, SLOT_SYNC);
-		log->sync_lsn = slot->slot_end_lsn;
 	}
 	log->write_lsn = slot->slot_end_lsn;
 	WT_ERR(__wt_cond_signal(session, log->log_release_cond));
@@ -540,6 +733,15 @@ __log_release(WT_SESSION_IMPL *session, WT_LOGSLOT *slot)
 
 err:	if (ret != 0 && slot->slot_error == 0)
 		slot->slot_error = ret;
+
+	/*
+	 * The log can't be synced past a failed write or sync: tell commits
+	 * waiting for a sync, whatever slot they joined.
+	 */
+	if (ret != 0 && log->sync_error == 0) {
+		log->sync_error = ret;
+		(void)__wt_cond_signal(session, log->log_sync_cond);
+	}
 	return (ret);
 }
 
@@ -569,9 +771,29 @@ __wt_log_newfile(WT_SESSION_IMPL *session, int conn_create)
 	WT_ASSERT(session, log->log_close_fh == NULL);
 	log->log_close_fh = log->log_fh;
 	log->fileid++;
+
+	/*
+	 * If log files are being pre-allocated, switch to a prepared file
+	 * rather than creating one.
+	 */
+	if (conn->log_prealloc > 0) {
+		ret = __log_alloc_prealloc(session, log->fileid);
+		if (ret == 0)
+			WT_STAT_FAST_CONN_INCR(session, log_prealloc_used);
+		else if (ret == WT_NOTFOUND) {
+			WT_STAT_FAST_CONN_INCR(session, log_prealloc_missed);
+			ret = 0;
+		}
+		WT_RET(ret);
+	}
 	WT_RET(__log_openfile(session, 1, &log->log_fh, log->fileid));
+
+	/*
+	 * A new log file starts out empty: pre-allocated files are zero-filled
+	 * to their full size.
+	 */
 	log->alloc_lsn.file = log->fileid;
-	log->alloc_lsn.offset = log->log_fh->size;
+	log->alloc_lsn.offset = 0;
 
 	/*
 	 * Set up the log descriptor record.  Use a scratch buffer to
@@ -620,6 +842,120 @@ err:	__wt_scr_free(&buf);
 	return (ret);
 }
 
+/*
+ * __log_compress --
+ *	Compress a log record, returning a scratch buffer holding the
+ *	compressed record, or NULL if the record isn't worth compressing.
+ */
+static int
+__log_compress(WT_SESSION_IMPL *session, WT_ITEM *record, WT_ITEM **citemp)
+{
+	WT_COMPRESSOR *compressor;
+	WT_DECL_ITEM(citem);
+	WT_DECL_RET;
+	WT_LOG *log;
+	WT_LOG_RECORD *logrec;
+	size_t len, result_len, src_len;
+	int compression_failed;
+	uint8_t *src;
+
+	*citemp = NULL;
+
+	compressor = S2C(session)->log_compressor;
+	log = S2C(session)->log;
+
+	/* Skip the header bytes of the source data. */
+	src = (uint8_t *)record->mem + WT_LOG_COMPRESS_SKIP;
+	src_len = record->size - WT_LOG_COMPRESS_SKIP;
+
+	/*
+	 * Compute the size needed for the destination buffer: some compression
+	 * engines need more memory than a copy of the original.
+	 */
+	if (compressor->pre_size == NULL)
+		len = src_len;
+	else
+		WT_RET(compressor->pre_size(compressor,
+		    &session->iface, src, src_len, &len));
+	WT_RET(__wt_scr_alloc(session, len + WT_LOG_COMPRESS_SKIP, &citem));
+
+	/*
+	 * If compression fails, or doesn't reduce the space the record takes
+	 * in the log, use the original record.
+	 */
+	compression_failed = 0;
+	WT_ERR(compressor->compress(compressor, &session->iface,
+	    src, src_len,
+	    (uint8_t *)citem->mem + WT_LOG_COMPRESS_SKIP, len,
+	    &result_len, &compression_failed));
+	if (compression_failed || __wt_rduppo2(
+	    (uint32_t)(result_len + WT_LOG_COMPRESS_SKIP), log->allocsize) >=
+	    __wt_rduppo2(record->size, log->allocsize)) {
+		WT_STAT_FAST_CONN_INCR(session, log_compress_write_fails);
+		goto err;
+	}
+
+	/* Copy in the skipped header bytes, set the final data size. */
+	memcpy(citem->mem, record->mem, WT_LOG_COMPRESS_SKIP);
+	citem->size = (uint32_t)(result_len + WT_LOG_COMPRESS_SKIP);
+	logrec = (WT_LOG_RECORD *)citem->mem;
+	F_SET(logrec, WT_LOG_RECORD_COMPRESSED);
+	logrec->mem_len = record->size;
+
+	WT_STAT_FAST_CONN_INCR(session, log_compress_writes);
+	WT_STAT_FAST_CONN_INCRV(session, log_compress_mem, record->size);
+	WT_STAT_FAST_CONN_INCRV(session, log_compress_len, citem->size);
+
+	*citemp = citem;
+	return (0);
+
+err:	__wt_scr_free(&citem);
+	return (ret);
+}
+
+/*
+ * __log_decompress --
+ *	Decompress a log record read from the log.
+ */
+static int
+__log_decompress(WT_SESSION_IMPL *session, WT_ITEM *in, WT_ITEM *out)
+{
+	WT_COMPRESSOR *compressor;
+	const WT_LOG_RECORD *inrec;
+	WT_LOG_RECORD *logrec;
+	size_t result_len;
+
+	compressor = S2C(session)->log_compressor;
+	inrec = in->data;
+
+	if (compressor == NULL || compressor->decompress == NULL)
+		WT_RET_MSG(session, WT_ERROR,
+		    "read compressed log record where no compression engine "
+		    "configured");
+
+	/*
+	 * Copy the skipped header bytes into place, then decompress.  As with
+	 * file blocks, the source length includes the padding to the end of
+	 * the record, compression engines must cope with trailing bytes.
+	 */
+	WT_RET(__wt_buf_initsize(session, out, inrec->mem_len));
+	memcpy(out->mem, inrec, WT_LOG_COMPRESS_SKIP);
+	WT_RET(compressor->decompress(compressor, &session->iface,
+	    (uint8_t *)inrec + WT_LOG_COMPRESS_SKIP,
+	    inrec->len - WT_LOG_COMPRESS_SKIP,
+	    (uint8_t *)out->mem + WT_LOG_COMPRESS_SKIP,
+	    inrec->mem_len - WT_LOG_COMPRESS_SKIP, &result_len));
+	if (result_len + WT_LOG_COMPRESS_SKIP != inrec->mem_len)
+		WT_RET_MSG(session, WT_ERROR,
+		    "log record decompression failed");
+
+	/* The caller sees the record as if it had never been compressed. */
+	logrec = (WT_LOG_RECORD *)out->mem;
+	logrec->len = logrec->mem_len;
+	F_CLR(logrec, WT_LOG_RECORD_COMPRESSED);
+	return (0);
+}
+
 /*
  * __wt_log_read --
  *	Read the log record at the given LSN.  Return the record (including
@@ -630,6 +966,7 @@ __wt_log_read(WT_SESSION_IMPL *session, WT_ITEM *record, WT_LSN *lsnp,
     uint32_t flags)
 {
 	WT_CONNECTION_IMPL *conn;
+	WT_DECL_ITEM(uncitem);
 	WT_DECL_RET;
 	WT_FH *log_fh;
 	WT_LOG *log;
@@ -685,12 +1022,48 @@ __wt_log_read(WT_SESSION_IMPL *session, WT_ITEM *record, WT_LSN *lsnp,
 	if (logrec->checksum != cksum)
 		WT_ERR_MSG(session, WT_ERROR, "log_read: Bad checksum");
 	record->size = logrec->len;
+	if (F_ISSET(logrec, WT_LOG_RECORD_COMPRESSED)) {
+		WT_ERR(__wt_scr_alloc(session, 0, &uncitem));
+		WT_ERR(__log_decompress(session, record, uncitem));
+		WT_ERR(__wt_buf_set(
+		    session, record, uncitem->data, uncitem->size));
+	}
 	WT_STAT_FAST_CONN_INCR(session, log_reads);
 err:
+	__wt_scr_free(&uncitem);
 	WT_TRET(__wt_close(session, log_fh));
 	return (ret);
 }
 
+/*
+ * __log_scan_read --
+ *	Make sure a range of a log file is in the log scan's read buffer,
+ * reading ahead of it.
+ */
+static int
+__log_scan_read(WT_SESSION_IMPL *session, WT_FH *log_fh, off_t log_size,
+    WT_ITEM *rdbuf, off_t *rd_startp, off_t offset, uint32_t len)
+{
+	size_t rdlen;
+
+	if (rdbuf->size != 0 && offset >= *rd_startp &&
+	    offset + len <= *rd_startp + (off_t)rdbuf->size)
+		return (0);
+
+	/*
+	 * Read ahead, but not past the end of the file: if the range itself
+	 * goes past the end of the file, let the read fail.
+	 */
+	rdlen = WT_MAX(len, WT_LOG_SCAN_READ_AHEAD);
+	if (offset + (off_t)rdlen > log_size)
+		rdlen = WT_MAX(len, (size_t)(log_size - offset));
+	WT_RET(__wt_buf_init(session, rdbuf, rdlen));
+	WT_RET(__wt_read(session, log_fh, offset, rdlen, rdbuf->mem));
+	rdbuf->size = rdlen;
+	*rd_startp = offset;
+	return (0);
+}
+
 /*
  * __wt_log_scan --
  *	Scan the logs, calling a function on each record found.
@@ -701,13 +1074,14 @@ __wt_log_scan(WT_SESSION_IMPL *session, WT_LSN *lsnp, uint32_t flags,
     WT_ITEM *record, WT_LSN *lsnp, void *cookie), void *cookie)
 {
 	WT_CONNECTION_IMPL *conn;
-	WT_ITEM buf;
+	WT_ITEM buf, rdbuf;
+	WT_DECL_ITEM(uncitem);
 	WT_DECL_RET;
 	WT_FH *log_fh;
 	WT_LOG *log;
 	WT_LOG_RECORD *logrec;
 	WT_LSN end_lsn, rd_lsn, start_lsn;
-	off_t log_size;
+	off_t log_size, rd_start;
 	uint32_t allocsize, cksum, firstlog, lastlog, lognum, rdup_len, reclen;
 	u_int i, logcount;
 	int done;
@@ -718,7 +1092,9 @@ __wt_log_scan(WT_SESSION_IMPL *session, WT_LSN *lsnp, uint32_t flags,
 	log_fh = NULL;
 	logcount = 0;
 	logfiles = NULL;
+	rd_start = 0;
 	WT_CLEAR(buf);
+	WT_CLEAR(rdbuf);
 
 	/*
 	 * If the caller did not give us a callback function there is nothing
@@ -795,7 +1171,6 @@ __wt_log_scan(WT_SESSION_IMPL *session, WT_LSN *lsnp, uint32_t flags,
 	else
 		done = 0;
 	rd_lsn = start_lsn;
-	WT_ERR(__wt_buf_initsize(session, &buf, LOG_ALIGN));
 	do {
 		if (rd_lsn.offset >= log_size) {
 			/*
@@ -803,6 +1178,7 @@ __wt_log_scan(WT_SESSION_IMPL *session, WT_LSN *lsnp, uint32_t flags,
 			 */
 			WT_ERR(__wt_close(session, log_fh));
 			log_fh = NULL;
+			rdbuf.size = 0;
 			/*
 			 * Truncate this log file before we move to the next.
 			 */
@@ -822,18 +1198,21 @@ __wt_log_scan(WT_SESSION_IMPL *session, WT_LSN *lsnp, uint32_t flags,
 			continue;
 		}
 		/*
-		 * Read the minimum allocation size a record could be.
+		 * Read the minimum allocation size a record could be.  Reads
+		 * are done in large chunks, most records will already be in
+		 * the read buffer.
 		 */
-		WT_ASSERT(session, buf.memsize >= allocsize);
-		WT_ERR(__wt_read(
-		    session, log_fh, rd_lsn.offset, allocsize, buf.mem));
+		WT_ERR(__log_scan_read(session, log_fh, log_size,
+		    &rdbuf, &rd_start, rd_lsn.offset, allocsize));
+		logrec = (WT_LOG_RECORD *)
+		    ((uint8_t *)rdbuf.mem + (rd_lsn.offset - rd_start));
 		/*
 		 * First 8 bytes is the real record length.  See if we
 		 * need to read more than the allocation size.  We expect
 		 * that we rarely will have to read more.  Most log records
 		 * will be fairly small.
 		 */
-		reclen = *(uint32_t *)buf.mem;
+		reclen = logrec->len;
 		/*
 		 * Log files are pre-allocated.  We never expect a zero length
 		 * unless we've reached the end of the log.  The log can be
@@ -846,17 +1225,18 @@ __wt_log_scan(WT_SESSION_IMPL *session, WT_LSN *lsnp, uint32_t flags,
 			break;
 		}
 		rdup_len = __wt_rduppo2(reclen, allocsize);
-		if (reclen > allocsize) {
-			WT_ERR(__wt_buf_grow(session, &buf, rdup_len));
-			WT_ERR(__wt_read(
-			    session, log_fh, rd_lsn.offset, reclen, buf.mem));
+		if (rd_lsn.offset + reclen > rd_start + (off_t)rdbuf.size) {
+			WT_ERR(__log_scan_read(session, log_fh, log_size,
+			    &rdbuf, &rd_start, rd_lsn.offset, reclen));
+			logrec = (WT_LOG_RECORD *)
+			    ((uint8_t *)rdbuf.mem + (rd_lsn.offset - rd_start));
 			WT_STAT_FAST_CONN_INCR(session, log_scan_rereads);
 		}
 		/*
 		 * We read in the record, verify checksum.
 		 */
+		buf.data = logrec;
 		buf.size = reclen;
-		logrec = (WT_LOG_RECORD *)buf.mem;
 		cksum = logrec->checksum;
 		logrec->checksum = 0;
 		logrec->checksum = __wt_cksum(logrec, logrec->len);
@@ -875,10 +1255,21 @@ __wt_log_scan(WT_SESSION_IMPL *session, WT_LSN *lsnp, uint32_t flags,
 
 		/*
 		 * We have a valid log record.  If it is not the log file
-		 * header, invoke the callback.
+		 * header, invoke the callback, decompressing the record
+		 * first if necessary.
 		 */
-		if (rd_lsn.offset != 0)
-			WT_ERR((*func)(session, &buf, &rd_lsn, cookie));
+		if (rd_lsn.offset != 0) {
+			if (F_ISSET(logrec, WT_LOG_RECORD_COMPRESSED)) {
+				if (uncitem == NULL)
+					WT_ERR(__wt_scr_alloc(
+					    session, 0, &uncitem));
+				WT_ERR(
+				    __log_decompress(session, &buf, uncitem));
+				WT_ERR((*func)(
+				    session, uncitem, &rd_lsn, cookie));
+			} else
+				WT_ERR((*func)(session, &buf, &rd_lsn, cookie));
+		}
 
 		WT_STAT_FAST_CONN_INCR(session, log_scan_records);
 		rd_lsn.offset += (off_t)rdup_len;
@@ -892,7 +1283,8 @@ __wt_log_scan(WT_SESSION_IMPL *session, WT_LSN *lsnp, uint32_t flags,
 err:	WT_STAT_FAST_CONN_INCR(session, log_scans);
 	if (logfiles != NULL)
 		__wt_log_files_free(session, logfiles, logcount);
-	__wt_buf_free(session, &buf);
+	__wt_buf_free(session, &rdbuf);
+	__wt_scr_free(&uncitem);
 	if (ret == ENOENT)
 		ret = 0;
 	if (log_fh != NULL)
@@ -900,6 +1292,30 @@ err:	WT_STAT_FAST_CONN_INCR(session, log_scans);
 	return (ret);
 }
 
+/*
+ * __log_sync_wait --
+ *	Wait for the log to be synced past an LSN.
+ */
+static int
+__log_sync_wait(WT_SESSION_IMPL *session, WT_LSN *lsnp)
+{
+	WT_LOG *log;
+
+	log = S2C(session)->log;
+
+	/*
+	 * Whichever thread syncs the log signals when it's done, or when the
+	 * log can't be synced.  Don't wait forever: if a notification gets
+	 * lost, we want to find out.
+	 */
+	while (LOG_CMP(&log->sync_lsn, lsnp) <= 0) {
+		if (log->sync_error != 0)
+			return (log->sync_error);
+		WT_RET(__wt_cond_wait(session, log->log_sync_cond, 10000));
+	}
+	return (0);
+}
+
 /*
  * __log_direct_write --
  *	Write a log record without using the consolidation arrays.
@@ -946,17 +1362,18 @@ __wt_log_write(WT_SESSION_IMPL *session, WT_ITEM *record, WT_LSN *lsnp,
     uint32_t flags)
 {
 	WT_CONNECTION_IMPL *conn;
+	WT_DECL_ITEM(citem);
 	WT_DECL_RET;
 	WT_LOG *log;
 	WT_LOG_RECORD *logrec;
 	WT_LSN tmp_lsn;
 	WT_MYSLOT myslot;
 	uint32_t rdup_len;
-	int locked;
+	int locked, slot_error;
 
 	conn = S2C(session);
 	log = conn->log;
-	locked = 0;
+	locked = slot_error = 0;
 	myslot.slot = NULL;
 	INIT_LSN(&tmp_lsn);
 	/*
@@ -969,6 +1386,25 @@ __wt_log_write(WT_SESSION_IMPL *session, WT_ITEM *record, WT_LSN *lsnp,
 	 * direct_io is in use because it makes the reading code cleaner.
 	 */
 	WT_STAT_FAST_CONN_INCRV(session, log_bytes_user, record->size);
+	logrec = (WT_LOG_RECORD *)record->mem;
+	logrec->flags = 0;
+	logrec->mem_len = 0;
+
+	/*
+	 * Optionally compress the record, but don't compress records that fit
+	 * in the minimum allocation size, they won't get any smaller.
+	 */
+	if (conn->log_compressor != NULL &&
+	    conn->log_compressor->compress != NULL) {
+		if (record->size <= log->allocsize)
+			WT_STAT_FAST_CONN_INCR(session, log_compress_small);
+		else {
+			WT_ERR(__log_compress(session, record, &citem));
+			if (citem != NULL)
+				record = citem;
+		}
+	}
+
 	rdup_len = __wt_rduppo2(record->size, log->allocsize);
 	WT_ERR(__wt_buf_grow(session, record, rdup_len));
 	WT_ASSERT(session, record->data == record->mem);
@@ -989,9 +1425,9 @@ __wt_log_write(WT_SESSION_IMPL *session, WT_ITEM *record, WT_LSN *lsnp,
 	WT_STAT_FAST_CONN_INCR(session, log_writes);
 
 	if (!F_ISSET(log, WT_LOG_FORCE_CONSOLIDATE)) {
-		ret = __log_direct_write(session, record, lsnp, flags);
+		ret = __log_direct_write(session, record, &tmp_lsn, flags);
 		if (ret == 0)
-			return (0);
+			goto done;
 		if (ret != EAGAIN)
 			WT_ERR(ret);
 		/*
@@ -1014,7 +1450,7 @@ __wt_log_write(WT_SESSION_IMPL *session, WT_ITEM *record, WT_LSN *lsnp,
 		 * write the record directly.
 		 */
 		while ((ret = __log_direct_write(
-		    session, record, lsnp, flags)) == EAGAIN)
+		    session, record, &tmp_lsn, flags)) == EAGAIN)
 			;
 		WT_ERR(ret);
 		/*
@@ -1022,7 +1458,7 @@ __wt_log_write(WT_SESSION_IMPL *session, WT_ITEM *record, WT_LSN *lsnp,
 		 * to, so future consolidations are likely to succeed.
 		 */
 		WT_ERR(__wt_log_slot_grow_buffers(session, 4 * rdup_len));
-		return (0);
+		goto done;
 	}
 	WT_ERR(ret);
 	if (myslot.offset == 0) {
@@ -1040,13 +1476,14 @@ __wt_log_write(WT_SESSION_IMPL *session, WT_ITEM *record, WT_LSN *lsnp,
 	if (__wt_log_slot_release(myslot.slot, rdup_len) ==
 	    WT_LOG_SLOT_DONE) {
 		WT_ERR(__log_release(session, myslot.slot));
+		/* Other threads can reuse the slot once it's freed. */
+		slot_error = myslot.slot->slot_error;
 		WT_ERR(__wt_log_slot_free(myslot.slot));
-	} else if (LF_ISSET(WT_LOG_FSYNC)) {
-		/* Wait for our slot to be finalized */
-		while (LOG_CMP(&log->sync_lsn, &tmp_lsn) <= 0 &&
-		    myslot.slot->slot_error == 0)
-			__wt_yield();
 	}
+
+	/* Wait for our record to be synced. */
+done:	if (LF_ISSET(WT_LOG_FSYNC))
+		WT_ERR(__log_sync_wait(session, &tmp_lsn));
 err:
 	if (locked)
 		__wt_spin_unlock(session, &log->log_slot_lock);
@@ -1057,11 +1494,14 @@ err:
 	 * if our write made it out to the file or not.  The error could be
 	 * before or after us.  So, if anyone got an error, we report it.
 	 * If we're not synchronous, only report if our own operation got
-	 * an error.
+	 * an error.  Only the thread that released the slot can look at the
+	 * slot's error, other threads check for a failure writing or syncing
+	 * any part of the log.
 	 */
 	if (LF_ISSET(WT_LOG_DSYNC | WT_LOG_FSYNC) && ret == 0 &&
 	    myslot.slot != NULL)
-		ret = myslot.slot->slot_error;
+		ret = slot_error != 0 ? slot_error : log->sync_error;
+	__wt_scr_free(&citem);
 	return (ret);
 }
 
@@ -0,0 +1,190 @@
+/*-
+ * Copyright (c) 2008-2013 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+#ifdef HAVE_LINUX_AIO
+#include <linux/aio_abi.h>
+#include <sys/syscall.h>
+
+/*
+ * There's no C library support for the Linux native AIO calls, and we don't
+ * want a dependency on libaio, make the system calls directly.
+ */
+#define	WT_IO_SETUP(nr, ctxp)						\
+	syscall(SYS_io_setup, (u_int)(nr), (ctxp))
+#define	WT_IO_DESTROY(ctx)						\
+	syscall(SYS_io_destroy, (ctx))
+#define	WT_IO_SUBMIT(ctx, nr, iocbpp)					\
+	syscall(SYS_io_submit, (ctx), (long)(nr), (iocbpp))
+#define	WT_IO_GETEVENTS(ctx, min, max, events)				\
+	syscall(SYS_io_getevents,					\
+	    (ctx), (long)(min), (long)(max), (events), NULL)
+#endif
+
+/*
+ * __wt_aio_open --
+ *	Create an asynchronous I/O context.
+ */
+int
+__wt_aio_open(WT_SESSION_IMPL *session, u_int depth, WT_AIO **aiop)
+{
+#ifdef HAVE_LINUX_AIO
+	WT_AIO *aio;
+	WT_DECL_RET;
+	aio_context_t ctx;
+
+	*aiop = NULL;
+	aio = NULL;
+
+	/*
+	 * Don't complain if we can't create a context, the kernel limits the
+	 * total number of requests and our caller may fall back to synchronous
+	 * I/O.
+	 */
+	ctx = 0;
+	if (WT_IO_SETUP(depth, &ctx) != 0)
+		return (__wt_errno());
+
+	WT_ERR(__wt_calloc_def(session, 1, &aio));
+	aio->ctx = (uint64_t)ctx;
+	aio->depth = depth;
+	WT_ERR(__wt_calloc(session, depth, sizeof(struct iocb), &aio->iocb));
+	WT_ERR(__wt_calloc(
+	    session, depth, sizeof(struct io_event), &aio->events));
+
+	*aiop = aio;
+	return (0);
+
+err:	if (aio != NULL) {
+		__wt_free(session, aio->iocb);
+		__wt_free(session, aio->events);
+		__wt_free(session, aio);
+	}
+	(void)WT_IO_DESTROY(ctx);
+	return (ret);
+#else
+	WT_UNUSED(depth);
+	*aiop = NULL;
+	WT_RET_MSG(session, ENOTSUP,
+	    "asynchronous I/O not supported on this platform");
+#endif
+}
+
+/*
+ * __wt_aio_close --
+ *	Discard an asynchronous I/O context.  Writes still in flight are
+ * cancelled or complete, the kernel waits for them before returning.
+ */
+int
+__wt_aio_close(WT_SESSION_IMPL *session, WT_AIO **aiop)
+{
+	WT_AIO *aio;
+	WT_DECL_RET;
+
+	if ((aio = *aiop) == NULL)
+		return (0);
+	*aiop = NULL;
+
+#ifdef HAVE_LINUX_AIO
+	if (WT_IO_DESTROY((aio_context_t)aio->ctx) != 0) {
+		ret = __wt_errno();
+		__wt_err(session, ret, "io_destroy");
+	}
+#endif
+	__wt_free(session, aio->iocb);
+	__wt_free(session, aio->events);
+	__wt_free(session, aio);
+	return (ret);
+}
+
+/*
+ * __wt_aio_write --
+ *	Start an asynchronous write using a request slot.  The buffer must not
+ * be modified until the slot's write completes.
+ */
+int
+__wt_aio_write(WT_SESSION_IMPL *session, WT_AIO *aio, u_int slot,
+    WT_FH *fh, off_t offset, uint32_t bytes, const void *buf)
+{
+#ifdef HAVE_LINUX_AIO
+	struct iocb *iocb;
+	WT_DECL_RET;
+
+	WT_STAT_FAST_CONN_INCR(session, write_io);
+
+	WT_VERBOSE_RET(session, fileops,
+	    "%s: async write %" PRIu32 " bytes at offset %" PRIuMAX,
+	    fh->name, bytes, (uintmax_t)offset);
+
+	WT_ASSERT(session, slot < aio->depth);
+	iocb = (struct iocb *)aio->iocb + slot;
+	memset(iocb, 0, sizeof(*iocb));
+	iocb->aio_data = slot;
+	iocb->aio_lio_opcode = IOCB_CMD_PWRITE;
+	iocb->aio_fildes = (uint32_t)fh->fd;
+	iocb->aio_buf = (uint64_t)(uintptr_t)buf;
+	iocb->aio_nbytes = bytes;
+	iocb->aio_offset = (int64_t)offset;
+
+	WT_SYSCALL_RETRY(WT_IO_SUBMIT(
+	    (aio_context_t)aio->ctx, 1, &iocb) == 1 ? 0 : -1, ret);
+	if (ret != 0)
+		WT_RET_MSG(session, ret,
+		    "%s async write error: failed to write %" PRIu32
+		    " bytes at offset %" PRIuMAX,
+		    fh->name, bytes, (uintmax_t)offset);
+	return (0);
+#else
+	WT_UNUSED(aio);
+	WT_UNUSED(slot);
+	WT_UNUSED(fh);
+	WT_UNUSED(offset);
+	WT_UNUSED(bytes);
+	WT_UNUSED(buf);
+	return (ENOTSUP);
+#endif
+}
+
+/*
+ * __wt_aio_reap --
+ *	Wait for at least min writes to complete, returning the completed
+ * writes.  The events array must have a slot for each request slot.
+ */
+int
+__wt_aio_reap(WT_SESSION_IMPL *session,
+    WT_AIO *aio, u_int min, WT_AIO_EVENT *events, u_int *countp)
+{
+#ifdef HAVE_LINUX_AIO
+	struct io_event *ev;
+	WT_DECL_RET;
+	long i, n;
+
+	*countp = 0;
+	for (;;) {
+		if ((n = WT_IO_GETEVENTS((aio_context_t)aio->ctx,
+		    min, aio->depth, aio->events)) >= 0)
+			break;
+		if ((ret = __wt_errno()) != EINTR)
+			WT_RET_MSG(session, ret, "io_getevents");
+	}
+
+	for (i = 0, ev = aio->events; i < n; ++i, ++ev, ++events) {
+		events->slot = (u_int)ev->data;
+		events->result = ev->res;
+	}
+	*countp = (u_int)n;
+	return (0);
+#else
+	WT_UNUSED(session);
+	WT_UNUSED(aio);
+	WT_UNUSED(min);
+	WT_UNUSED(events);
+	*countp = 0;
+	return (ENOTSUP);
+#endif
+}
@@ -9,17 +9,19 @@
 
 /*
  * __wt_mmap --
- *	Map a file into memory.
+ *	Map a file into memory.  The length can be larger than the file, the
+ * part of the mapping past the end of the file becomes usable as the file
+ * grows.
  */
 int
-__wt_mmap(WT_SESSION_IMPL *session, WT_FH *fh, void *mapp, size_t *lenp)
+__wt_mmap(WT_SESSION_IMPL *session, WT_FH *fh, size_t len, void *mapp)
 {
 	void *map;
 
 	WT_VERBOSE_RET(session, fileops,
-	    "%s: map %" PRIuMAX " bytes", fh->name, (uintmax_t)fh->size);
+	    "%s: map %" PRIuMAX " bytes", fh->name, (uintmax_t)len);
 
-	if ((map = mmap(NULL, (size_t)fh->size,
+	if ((map = mmap(NULL, len,
 	    PROT_READ,
 #ifdef MAP_NOCORE
 	    MAP_NOCORE |
@@ -28,11 +30,10 @@ __wt_mmap(WT_SESSION_IMPL *session, WT_FH *fh, void *mapp, size_t *lenp)
 	    fh->fd, (off_t)0)) == MAP_FAILED) {
 		WT_RET_MSG(session, __wt_errno(),
 		    "%s map error: failed to map %" PRIuMAX " bytes",
-		    fh->name, (uintmax_t)fh->size);
+		    fh->name, (uintmax_t)len);
 	}
 
 	*(void **)mapp = map;
-	*lenp = (size_t)fh->size;
 	return (0);
 }
 
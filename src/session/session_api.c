@@ -421,6 +421,111 @@ err:	/* Note: drop operations cannot be unrolled (yet?). */
 	API_END_NOTFOUND_MAP(session, ret);
 }
 
+/*
+ * __session_prefetch_range --
+ *	Prefetch the pages of an object between two cursor positions.
+ */
+static int
+__session_prefetch_range(WT_SESSION_IMPL *session,
+    WT_CURSOR *cursor, WT_CURSOR *start, WT_CURSOR *stop)
+{
+	WT_CURSOR_TABLE *ctable, *cstart, *cstop;
+	WT_DECL_RET;
+	u_int i;
+
+	/*
+	 * Prefetch files, and the column groups of tables; other objects
+	 * ignore the hint.
+	 */
+	if (WT_PREFIX_MATCH(cursor->uri, "file:"))
+		WT_WITH_BTREE(session, ((WT_CURSOR_BTREE *)cursor)->btree,
+		    ret = __wt_prefetch_range(session,
+			(WT_CURSOR_BTREE *)start, (WT_CURSOR_BTREE *)stop));
+	else if (WT_PREFIX_MATCH(cursor->uri, "table:")) {
+		ctable = (WT_CURSOR_TABLE *)cursor;
+		cstart = (WT_CURSOR_TABLE *)start;
+		cstop = (WT_CURSOR_TABLE *)stop;
+		for (i = 0; i < WT_COLGROUPS(ctable->table); i++)
+			WT_RET(__session_prefetch_range(session,
+			    ctable->cg_cursors[i],
+			    cstart == NULL ? NULL : cstart->cg_cursors[i],
+			    cstop == NULL ? NULL : cstop->cg_cursors[i]));
+	}
+	return (ret);
+}
+
+/*
+ * __session_prefetch --
+ *	WT_SESSION->prefetch method.
+ */
+static int
+__session_prefetch(WT_SESSION *wt_session,
+    const char *uri, WT_CURSOR *start, WT_CURSOR *stop, const char *config)
+{
+	WT_CURSOR *cursor;
+	WT_DECL_RET;
+	WT_SESSION_IMPL *session;
+	int cmp;
+
+	session = (WT_SESSION_IMPL *)wt_session;
+	cursor = NULL;
+	SESSION_TXN_API_CALL(session, prefetch, config, cfg);
+	WT_UNUSED(cfg);
+
+	/*
+	 * The same rules as WT_SESSION::truncate apply: if the URI is
+	 * specified, we don't need a start/stop, if start/stop is specified,
+	 * we don't need a URI, and cursors must reference the same object.
+	 */
+	if ((uri == NULL && start == NULL && stop == NULL) ||
+	    (uri != NULL && (start != NULL || stop != NULL)))
+		WT_ERR_MSG(session, EINVAL,
+		    "the prefetch method should be passed either a URI or "
+		    "start/stop cursors, but not both");
+
+	/* Prefetch is a hint, ignored if there are no prefetch threads. */
+	if (S2C(session)->cache->pf_threads == 0)
+		goto done;
+
+	if (uri != NULL) {
+		/* Disallow objects in the WiredTiger name space. */
+		WT_ERR(__wt_schema_name_check(session, uri));
+
+		WT_ERR(__wt_open_cursor(session, uri, NULL, NULL, &cursor));
+		WT_ERR(__session_prefetch_range(session, cursor, NULL, NULL));
+		goto done;
+	}
+
+	cursor = start == NULL ? stop : start;
+	if (cursor->compare == NULL)
+		WT_ERR(__wt_bad_object_type(session, cursor->uri));
+	if (start != NULL && stop != NULL) {
+		WT_ERR(start->compare(start, stop, &cmp));
+		if (cmp > 0)
+			goto done;
+	}
+
+	/*
+	 * Position the cursors, the keys don't have to exist.  If the object
+	 * is empty, there's nothing to prefetch.
+	 */
+	if (start != NULL && (ret = start->search_near(start, &cmp)) != 0) {
+		WT_ERR_NOTFOUND_OK(ret);
+		goto done;
+	}
+	if (stop != NULL && (ret = stop->search_near(stop, &cmp)) != 0) {
+		WT_ERR_NOTFOUND_OK(ret);
+		goto done;
+	}
+	WT_ERR(__session_prefetch_range(session, cursor, start, stop));
+
+done:
+err:	if (uri != NULL && cursor != NULL)
+		WT_TRET(cursor->close(cursor));
+	TXN_API_END_RETRY(session, ret, 0);
+	return ((ret) == WT_NOTFOUND ? ENOENT : (ret));
+}
+
 /*
  * __session_salvage --
  *	WT_SESSION->salvage method.
@@ -738,6 +843,7 @@ __wt_open_session(WT_CONNECTION_IMPL *conn, int internal,
 		__session_compact,
 		__session_drop,
 		__session_log_printf,
+		__session_prefetch,
 		__session_rename,
 		__session_salvage,
 		__session_truncate,
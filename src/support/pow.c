@@ -63,6 +63,7 @@ __wt_nlpo2_round(uint32_t v)
 	v |= v >> 16;
 	return (v + 1);
 }
+#endif /* __WIREDTIGER_UNUSED__ */
 
 /*
  * __wt_nlpo2 --
@@ -78,7 +79,6 @@ __wt_nlpo2(uint32_t v)
 	v |= v >> 16;
 	return (v + 1);
 }
-#endif /* __WIREDTIGER_UNUSED__ */
 
 /*
  * __wt_log2_int --
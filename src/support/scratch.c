@@ -7,6 +7,7 @@
 
 #include "wt_internal.h"
 
+static int  __buf_pool_realloc(WT_SESSION_IMPL *, size_t *, size_t, void *);
 static void __wt_buf_clear(WT_ITEM *);
 
 /*
@@ -62,7 +63,11 @@ __wt_buf_grow(WT_SESSION_IMPL *session, WT_ITEM *buf, size_t size)
 			set_data = 0;
 		}
 
-		if (F_ISSET(buf, WT_ITEM_ALIGNED))
+		if (F_ISSET(buf, WT_ITEM_ALIGNED) &&
+		    session != NULL && S2C(session)->buf_pool != NULL)
+			WT_RET(__buf_pool_realloc(
+			    session, &buf->memsize, size, &buf->mem));
+		else if (F_ISSET(buf, WT_ITEM_ALIGNED))
 			WT_RET(__wt_realloc_aligned(
 			    session, &buf->memsize, size, &buf->mem));
 		else
@@ -194,8 +199,12 @@ __wt_buf_steal(WT_SESSION_IMPL *session, WT_ITEM *buf, uint32_t *sizep)
 void
 __wt_buf_free(WT_SESSION_IMPL *session, WT_ITEM *buf)
 {
-	if (!F_ISSET(buf, WT_ITEM_MAPPED))
-		__wt_free(session, buf->mem);
+	if (!F_ISSET(buf, WT_ITEM_MAPPED)) {
+		if (F_ISSET(buf, WT_ITEM_ALIGNED))
+			__wt_buf_pool_free(session, buf->mem, buf->memsize);
+		else
+			__wt_free(session, buf->mem);
+	}
 	__wt_buf_clear(buf);
 }
 
@@ -473,3 +482,169 @@ __wt_ext_scr_free(WT_EXTENSION_API *wt_api, WT_SESSION *wt_session, void *p)
 		}
 	__wt_errx(session, "extension free'd non-existent scratch buffer");
 }
+
+/*
+ * __wt_buf_pool_create --
+ *	Configure and create the I/O buffer pool.
+ */
+int
+__wt_buf_pool_create(WT_CONNECTION_IMPL *conn, const char *cfg[])
+{
+	WT_BUF_POOL *pool;
+	WT_CONFIG_ITEM cval;
+	WT_DECL_RET;
+	WT_SESSION_IMPL *session;
+
+	session = conn->default_session;
+
+	WT_RET(__wt_config_gets(session, cfg, "buffer_pool.size", &cval));
+	if (cval.val == 0)
+		return (0);
+
+	WT_RET(__wt_calloc_def(session, 1, &pool));
+	pool->bytes_max = (uint64_t)cval.val;
+
+	/*
+	 * Size classes are multiples of the I/O alignment, and at least the
+	 * default allocation size, so blocks of most files fill a size class.
+	 */
+	pool->unit = WT_MAX(conn->buffer_alignment, 4 * WT_KILOBYTE);
+	WT_ERR(__wt_spin_init(session, &pool->lock, "buffer pool"));
+
+	conn->buf_pool = pool;
+	return (0);
+
+err:	__wt_free(session, pool);
+	return (ret);
+}
+
+/*
+ * __wt_buf_pool_destroy --
+ *	Discard the I/O buffer pool.
+ */
+int
+__wt_buf_pool_destroy(WT_CONNECTION_IMPL *conn)
+{
+	WT_BUF_POOL *pool;
+	WT_SESSION_IMPL *session;
+	u_int i;
+	void *p;
+
+	session = conn->default_session;
+
+	if ((pool = conn->buf_pool) == NULL)
+		return (0);
+	conn->buf_pool = NULL;
+
+	for (i = 0; i < WT_BUF_POOL_CLASSES; ++i)
+		while ((p = pool->freeq[i]) != NULL) {
+			pool->freeq[i] = *(void **)p;
+			__wt_free(session, p);
+		}
+
+	__wt_spin_destroy(session, &pool->lock);
+	__wt_free(session, pool);
+	return (0);
+}
+
+/*
+ * __buf_pool_realloc --
+ *	Grow an aligned buffer using memory from the I/O buffer pool.
+ */
+static int
+__buf_pool_realloc(WT_SESSION_IMPL *session,
+    size_t *bytes_allocated_ret, size_t bytes_to_allocate, void *retp)
+{
+	WT_BUF_POOL *pool;
+	size_t bytes_allocated, size;
+	u_int slot;
+	void *newp, *p;
+
+	pool = S2C(session)->buf_pool;
+	p = *(void **)retp;
+	bytes_allocated = *bytes_allocated_ret;
+
+	/*
+	 * Round the request up to a size class and take a buffer from its free
+	 * list.  Requests larger than the largest size class are allocated at
+	 * their exact size, those buffers are never kept in the pool.
+	 */
+	newp = NULL;
+	size = WT_ALIGN(bytes_to_allocate, pool->unit);
+	if (size <= pool->unit * WT_BUF_POOL_CLASSES) {
+		slot = (u_int)(size / pool->unit) - 1;
+		__wt_spin_lock(session, &pool->lock);
+		if ((newp = pool->freeq[slot]) != NULL) {
+			pool->freeq[slot] = *(void **)newp;
+			pool->bytes_inuse -= size;
+			WT_STAT_FAST_CONN_SET(
+			    session, buffer_pool_bytes, pool->bytes_inuse);
+		}
+		__wt_spin_unlock(session, &pool->lock);
+	} else
+		size = bytes_to_allocate;
+
+	if (newp == NULL) {
+		WT_RET(__wt_realloc_aligned(session, NULL, size, &newp));
+		WT_STAT_FAST_CONN_INCR(session, buffer_pool_alloc);
+	} else {
+		/* Clear the memory, as the underlying allocator does. */
+		memset((uint8_t *)newp + bytes_allocated,
+		    0, size - bytes_allocated);
+		WT_STAT_FAST_CONN_INCR(session, buffer_pool_reuse);
+	}
+
+	if (p != NULL) {
+		memcpy(newp, p, bytes_allocated);
+		__wt_buf_pool_free(session, p, bytes_allocated);
+	}
+
+	*bytes_allocated_ret = size;
+	*(void **)retp = newp;
+	return (0);
+}
+
+/*
+ * __wt_buf_pool_free --
+ *	Return aligned memory to the I/O buffer pool, or free it.  The size
+ * may be smaller than the memory's allocation, never larger.
+ */
+void
+__wt_buf_pool_free(WT_SESSION_IMPL *session, void *p, size_t size)
+{
+	WT_BUF_POOL *pool;
+	size_t align;
+	u_int slot;
+
+	if (p == NULL)
+		return;
+
+	/*
+	 * Only keep memory that fills a size class and has the alignment I/O
+	 * requires, and don't hold more than the configured maximum.
+	 */
+	if (session == NULL ||
+	    (pool = S2C(session)->buf_pool) == NULL ||
+	    size < pool->unit || size % pool->unit != 0 ||
+	    size > pool->unit * WT_BUF_POOL_CLASSES ||
+	    ((align = S2C(session)->buffer_alignment) != 0 &&
+	    (uintptr_t)p % align != 0)) {
+		__wt_free(session, p);
+		return;
+	}
+
+	slot = (u_int)(size / pool->unit) - 1;
+	__wt_spin_lock(session, &pool->lock);
+	if (pool->bytes_inuse + size <= pool->bytes_max) {
+		*(void **)p = pool->freeq[slot];
+		pool->freeq[slot] = p;
+		pool->bytes_inuse += size;
+		WT_STAT_FAST_CONN_SET(
+		    session, buffer_pool_bytes, pool->bytes_inuse);
+		p = NULL;
+	}
+	__wt_spin_unlock(session, &pool->lock);
+
+	if (p != NULL)
+		__wt_free(session, p);
+}
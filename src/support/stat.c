@@ -67,6 +67,8 @@ __wt_stat_init_dsrc_stats(WT_DSRC_STATS *stats)
 	    "pages split because they were unable to be evicted";
 	stats->cache_overflow_value.desc = "overflow values cached in memory";
 	stats->cache_read.desc = "pages read into cache";
+	stats->cache_read_ahead.desc =
+	    "pages scheduled for read-ahead by cursor scans";
 	stats->cache_read_overflow.desc = "overflow pages read into cache";
 	stats->cache_write.desc = "pages written from cache";
 	stats->compress_raw_fail.desc =
@@ -172,6 +174,7 @@ __wt_stat_refresh_dsrc_stats(void *stats_arg)
 	stats->cache_inmem_split.v = 0;
 	stats->cache_overflow_value.v = 0;
 	stats->cache_read.v = 0;
+	stats->cache_read_ahead.v = 0;
 	stats->cache_read_overflow.v = 0;
 	stats->cache_write.v = 0;
 	stats->compress_raw_fail.v = 0;
@@ -258,6 +261,7 @@ __wt_stat_aggregate_dsrc_stats(const void *child, const void *parent)
 	p->cache_inmem_split.v += c->cache_inmem_split.v;
 	p->cache_overflow_value.v += c->cache_overflow_value.v;
 	p->cache_read.v += c->cache_read.v;
+	p->cache_read_ahead.v += c->cache_read_ahead.v;
 	p->cache_read_overflow.v += c->cache_read_overflow.v;
 	p->cache_write.v += c->cache_write.v;
 	p->compress_raw_fail.v += c->compress_raw_fail.v;
@@ -310,16 +314,49 @@ __wt_stat_init_connection_stats(WT_CONNECTION_STATS *stats)
 	stats->block_byte_map_read.desc = "block manager: mapped bytes read";
 	stats->block_byte_read.desc = "block manager: bytes read";
 	stats->block_byte_write.desc = "block manager: bytes written";
+	stats->block_cache_bytes.desc =
+	    "block manager: block cache bytes currently held";
+	stats->block_cache_evict.desc =
+	    "block manager: block cache page images discarded";
+	stats->block_cache_hit.desc = "block manager: block cache hits";
+	stats->block_cache_insert.desc =
+	    "block manager: block cache page images added";
+	stats->block_cache_miss.desc = "block manager: block cache misses";
+	stats->block_ckpt_throttle.desc =
+	    "block manager: checkpoint writes throttled";
+	stats->block_ckpt_throttle_time.desc =
+	    "block manager: checkpoint write throttle time (usecs)";
 	stats->block_map_read.desc = "block manager: mapped blocks read";
 	stats->block_preload.desc = "block manager: blocks pre-loaded";
 	stats->block_read.desc = "block manager: blocks read";
+	stats->block_remap.desc = "block manager: file mappings extended";
 	stats->block_write.desc = "block manager: blocks written";
+	stats->block_write_async.desc =
+	    "block manager: blocks written asynchronously";
+	stats->block_write_async_wait.desc =
+	    "block manager: waits for asynchronous writes to complete";
+	stats->buffer_pool_alloc.desc = "I/O buffer pool: buffers allocated";
+	stats->buffer_pool_bytes.desc =
+	    "I/O buffer pool: bytes currently held";
+	stats->buffer_pool_reuse.desc = "I/O buffer pool: buffers re-used";
+	stats->cache_arena_chunk.desc = "cache: page arena chunks allocated";
+	stats->cache_arena_reuse.desc = "cache: page arena structures reused";
+	stats->cache_bytes_clean_eviction.desc =
+	    "cache: dirty bytes cleaned by eviction";
+	stats->cache_bytes_clean_write_behind.desc =
+	    "cache: dirty bytes cleaned by write-behind threads";
 	stats->cache_bytes_dirty.desc =
 	    "cache: tracked dirty bytes in the cache";
 	stats->cache_bytes_inuse.desc = "cache: bytes currently in the cache";
 	stats->cache_bytes_max.desc = "cache: maximum bytes configured";
+	stats->cache_bytes_probation.desc =
+	    "cache: bytes in the probationary part of the cache";
+	stats->cache_bytes_protected.desc =
+	    "cache: bytes in the protected part of the cache";
 	stats->cache_bytes_read.desc = "cache: bytes read into cache";
 	stats->cache_bytes_write.desc = "cache: bytes written from cache";
+	stats->cache_eviction_app.desc =
+	    "cache: pages evicted by application threads";
 	stats->cache_eviction_checkpoint.desc =
 	    "cache: checkpoint blocked page eviction";
 	stats->cache_eviction_clean.desc = "cache: unmodified pages evicted";
@@ -339,20 +376,49 @@ __wt_stat_init_connection_stats(WT_CONNECTION_STATS *stats)
 	    "cache: internal page merge attempts that could not complete";
 	stats->cache_eviction_merge_levels.desc =
 	    "cache: internal levels merged";
+	stats->cache_eviction_server_evicting.desc =
+	    "cache: pages evicted by the eviction server";
 	stats->cache_eviction_slow.desc =
 	    "cache: eviction server unable to reach eviction goal";
 	stats->cache_eviction_walk.desc = "cache: pages walked for eviction";
+	stats->cache_eviction_worker_evicting.desc =
+	    "cache: pages evicted by eviction worker threads";
+	stats->cache_eviction_worker_evicting_max.desc =
+	    "cache: pages evicted by the busiest eviction worker thread";
+	stats->cache_eviction_worker_evicting_min.desc =
+	    "cache: pages evicted by the least busy eviction worker thread";
+	stats->cache_eviction_workers.desc =
+	    "cache: eviction worker threads currently running";
 	stats->cache_inmem_split.desc =
 	    "pages split because they were unable to be evicted";
+	stats->cache_leaf_hash.desc = "cache: leaf page hash indexes built";
 	stats->cache_pages_dirty.desc =
 	    "cache: tracked dirty pages in the cache";
 	stats->cache_pages_inuse.desc =
 	    "cache: pages currently held in the cache";
+	stats->cache_pages_protected.desc =
+	    "cache: pages moved to the protected part of the cache";
+	stats->cache_prefetch_queued.desc = "cache: pages queued for prefetch";
+	stats->cache_prefetch_read.desc =
+	    "cache: pages read into cache by prefetch threads";
+	stats->cache_prefetch_skipped.desc =
+	    "cache: prefetch requests skipped because the queue or cache was full";
+	stats->cache_prefetch_used.desc = "cache: prefetched pages used";
 	stats->cache_read.desc = "cache: pages read into cache";
+	stats->cache_read_ahead.desc =
+	    "cache: pages scheduled for read-ahead by cursor scans";
 	stats->cache_write.desc = "cache: pages written from cache";
+	stats->cache_write_behind.desc =
+	    "cache: pages written by write-behind threads";
 	stats->cond_wait.desc = "pthread mutex condition wait calls";
 	stats->cursor_create.desc = "cursor creation";
 	stats->cursor_insert.desc = "Btree cursor insert calls";
+	stats->cursor_insert_append_race.desc =
+	    "Btree cursor appends moved past a racing append";
+	stats->cursor_insert_finger.desc =
+	    "Btree cursor insert list searches from the cursor finger";
+	stats->cursor_insert_restart.desc =
+	    "Btree cursor inserts retried after racing an insert";
 	stats->cursor_next.desc = "Btree cursor next calls";
 	stats->cursor_prev.desc = "Btree cursor prev calls";
 	stats->cursor_remove.desc = "Btree cursor remove calls";
@@ -370,7 +436,20 @@ __wt_stat_init_connection_stats(WT_CONNECTION_STATS *stats)
 	stats->log_buffer_size.desc = "log: total log buffer size";
 	stats->log_bytes_user.desc = "log: user provided log bytes written";
 	stats->log_bytes_written.desc = "log: log bytes written";
+	stats->log_compress_len.desc = "log: total size of compressed records";
+	stats->log_compress_mem.desc =
+	    "log: total in-memory size of compressed records";
+	stats->log_compress_small.desc =
+	    "log: log records too small to compress";
+	stats->log_compress_write_fails.desc =
+	    "log: log records not compressed";
+	stats->log_compress_writes.desc = "log: log records compressed";
 	stats->log_max_filesize.desc = "log: maximum log file size";
+	stats->log_prealloc_files.desc =
+	    "log: pre-allocated log files prepared";
+	stats->log_prealloc_missed.desc =
+	    "log: log file switches without a pre-allocated file";
+	stats->log_prealloc_used.desc = "log: pre-allocated log files used";
 	stats->log_reads.desc = "log: log read operations";
 	stats->log_scan_records.desc = "log: records processed by log scan";
 	stats->log_scan_rereads.desc =
@@ -409,12 +488,24 @@ __wt_stat_init_connection_stats(WT_CONNECTION_STATS *stats)
 	stats->session_cursor_open.desc = "open cursor count";
 	stats->txn_begin.desc = "transactions";
 	stats->txn_checkpoint.desc = "transaction checkpoints";
+	stats->txn_checkpoint_incremental_bytes.desc =
+	    "transaction checkpoint dirty bytes written between checkpoints";
+	stats->txn_checkpoint_incremental_pages.desc =
+	    "transaction checkpoint pages written between checkpoints";
 	stats->txn_checkpoint_running.desc =
 	    "transaction checkpoint currently running";
 	stats->txn_commit.desc = "transactions committed";
 	stats->txn_fail_cache.desc =
 	    "transaction failures due to cache overflow";
+	stats->txn_recover_file.desc =
+	    "transaction recovery log file being replayed";
+	stats->txn_recover_ops.desc =
+	    "transaction recovery operations applied";
 	stats->txn_rollback.desc = "transactions rolled-back";
+	stats->txn_snapshot_states.desc =
+	    "transaction states examined for snapshots";
+	stats->txn_snapshot_time.desc = "transaction snapshot time (nsecs)";
+	stats->txn_snapshots.desc = "transaction snapshots";
 	stats->write_io.desc = "total write I/Os";
 }
 
@@ -427,13 +518,29 @@ __wt_stat_refresh_connection_stats(void *stats_arg)
 	stats->block_byte_map_read.v = 0;
 	stats->block_byte_read.v = 0;
 	stats->block_byte_write.v = 0;
+	stats->block_cache_evict.v = 0;
+	stats->block_cache_hit.v = 0;
+	stats->block_cache_insert.v = 0;
+	stats->block_cache_miss.v = 0;
+	stats->block_ckpt_throttle.v = 0;
+	stats->block_ckpt_throttle_time.v = 0;
 	stats->block_map_read.v = 0;
 	stats->block_preload.v = 0;
 	stats->block_read.v = 0;
+	stats->block_remap.v = 0;
 	stats->block_write.v = 0;
+	stats->block_write_async.v = 0;
+	stats->block_write_async_wait.v = 0;
+	stats->buffer_pool_alloc.v = 0;
+	stats->buffer_pool_reuse.v = 0;
+	stats->cache_arena_chunk.v = 0;
+	stats->cache_arena_reuse.v = 0;
+	stats->cache_bytes_clean_eviction.v = 0;
+	stats->cache_bytes_clean_write_behind.v = 0;
 	stats->cache_bytes_dirty.v = 0;
 	stats->cache_bytes_read.v = 0;
 	stats->cache_bytes_write.v = 0;
+	stats->cache_eviction_app.v = 0;
 	stats->cache_eviction_checkpoint.v = 0;
 	stats->cache_eviction_clean.v = 0;
 	stats->cache_eviction_dirty.v = 0;
@@ -445,15 +552,28 @@ __wt_stat_refresh_connection_stats(void *stats_arg)
 	stats->cache_eviction_merge.v = 0;
 	stats->cache_eviction_merge_fail.v = 0;
 	stats->cache_eviction_merge_levels.v = 0;
+	stats->cache_eviction_server_evicting.v = 0;
 	stats->cache_eviction_slow.v = 0;
 	stats->cache_eviction_walk.v = 0;
+	stats->cache_eviction_worker_evicting.v = 0;
 	stats->cache_inmem_split.v = 0;
+	stats->cache_leaf_hash.v = 0;
 	stats->cache_pages_dirty.v = 0;
+	stats->cache_pages_protected.v = 0;
+	stats->cache_prefetch_queued.v = 0;
+	stats->cache_prefetch_read.v = 0;
+	stats->cache_prefetch_skipped.v = 0;
+	stats->cache_prefetch_used.v = 0;
 	stats->cache_read.v = 0;
+	stats->cache_read_ahead.v = 0;
 	stats->cache_write.v = 0;
+	stats->cache_write_behind.v = 0;
 	stats->cond_wait.v = 0;
 	stats->cursor_create.v = 0;
 	stats->cursor_insert.v = 0;
+	stats->cursor_insert_append_race.v = 0;
+	stats->cursor_insert_finger.v = 0;
+	stats->cursor_insert_restart.v = 0;
 	stats->cursor_next.v = 0;
 	stats->cursor_prev.v = 0;
 	stats->cursor_remove.v = 0;
@@ -469,6 +589,14 @@ __wt_stat_refresh_connection_stats(void *stats_arg)
 	stats->log_buffer_grow.v = 0;
 	stats->log_bytes_user.v = 0;
 	stats->log_bytes_written.v = 0;
+	stats->log_compress_len.v = 0;
+	stats->log_compress_mem.v = 0;
+	stats->log_compress_small.v = 0;
+	stats->log_compress_write_fails.v = 0;
+	stats->log_compress_writes.v = 0;
+	stats->log_prealloc_files.v = 0;
+	stats->log_prealloc_missed.v = 0;
+	stats->log_prealloc_used.v = 0;
 	stats->log_reads.v = 0;
 	stats->log_scan_records.v = 0;
 	stats->log_scan_rereads.v = 0;
@@ -497,8 +625,14 @@ __wt_stat_refresh_connection_stats(void *stats_arg)
 	stats->rwlock_write.v = 0;
 	stats->txn_begin.v = 0;
 	stats->txn_checkpoint.v = 0;
+	stats->txn_checkpoint_incremental_bytes.v = 0;
+	stats->txn_checkpoint_incremental_pages.v = 0;
 	stats->txn_commit.v = 0;
 	stats->txn_fail_cache.v = 0;
+	stats->txn_recover_ops.v = 0;
 	stats->txn_rollback.v = 0;
+	stats->txn_snapshot_states.v = 0;
+	stats->txn_snapshot_time.v = 0;
+	stats->txn_snapshots.v = 0;
 	stats->write_io.v = 0;
 }
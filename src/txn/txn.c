@@ -57,6 +57,7 @@ __wt_txn_release_snapshot(WT_SESSION_IMPL *session)
 		    session->txn.isolation == TXN_ISO_READ_UNCOMMITTED ||
 		    !__wt_txn_visible_all(session, txn_state->snap_min));
 		txn_state->snap_min = WT_TXN_NONE;
+		__wt_txn_state_idle(session);
 	}
 }
 
@@ -92,9 +93,11 @@ __wt_txn_refresh(WT_SESSION_IMPL *session, uint64_t max_id, int get_snapshot)
 	WT_TXN *txn;
 	WT_TXN_GLOBAL *txn_global;
 	WT_TXN_STATE *s, *txn_state;
+	struct timespec start, stop;
 	uint64_t current_id, id, snap_min, oldest_id, prev_oldest_id;
-	uint32_t i, n, session_cnt;
+	uint32_t n, scanned, session_cnt, slot;
 	int32_t count;
+	int timed;
 
 	conn = S2C(session);
 	txn = &session->txn;
@@ -104,6 +107,10 @@ __wt_txn_refresh(WT_SESSION_IMPL *session, uint64_t max_id, int get_snapshot)
 	prev_oldest_id = txn_global->oldest_id;
 	current_id = snap_min = txn_global->current;
 
+	/* Our state is about to be published in the global table. */
+	if (get_snapshot)
+		__wt_txn_state_active(session);
+
 	/* For pure read-only workloads, avoid updates to shared state. */
 	if (!get_snapshot) {
 		/*
@@ -123,6 +130,10 @@ __wt_txn_refresh(WT_SESSION_IMPL *session, uint64_t max_id, int get_snapshot)
 			return;
 	}
 
+	/* Time snapshots if statistics are being gathered. */
+	timed = get_snapshot &&
+	    conn->stat_fast && __wt_epoch(session, &start) == 0;
+
 	/*
 	 * We're going to scan.  Increment the count of scanners to prevent the
 	 * oldest ID from moving forwards.  Spin if the count is negative,
@@ -141,9 +152,17 @@ __wt_txn_refresh(WT_SESSION_IMPL *session, uint64_t max_id, int get_snapshot)
 	/* If the maximum ID is constrained, so is the oldest. */
 	oldest_id = (max_id != WT_TXN_NONE) ? max_id : snap_min;
 
-	/* Walk the array of concurrent transactions. */
+	/*
+	 * Walk the array of concurrent transactions, skipping sessions without
+	 * an ID or snap_min published.  Sessions set their bit before they
+	 * publish anything, and transaction IDs are published before the
+	 * current ID moves past them, so any ID we need to see belongs to an
+	 * active session.
+	 */
 	WT_ORDERED_READ(session_cnt, conn->session_cnt);
-	for (i = n = 0, s = txn_global->states; i < session_cnt; i++, s++) {
+	for (n = scanned = slot = 0;
+	    (s = __wt_txn_state_next(txn_global, session_cnt, &slot)) != NULL;
+	    ++scanned) {
 		/*
 		 * Ignore the ID if we are committing (indicated by max_id
 		 * being set): it is about to be released.
@@ -208,7 +227,8 @@ __wt_txn_refresh(WT_SESSION_IMPL *session, uint64_t max_id, int get_snapshot)
 	    (!get_snapshot || oldest_id - prev_oldest_id > 100) &&
 	    WT_ATOMIC_CAS(txn_global->scan_count, 1, -1)) {
 		WT_ORDERED_READ(session_cnt, conn->session_cnt);
-		for (i = 0, s = txn_global->states; i < session_cnt; i++, s++) {
+		for (slot = 0; (s = __wt_txn_state_next(
+		    txn_global, session_cnt, &slot)) != NULL;) {
 			if ((id = s->id) != WT_TXN_NONE &&
 			    TXNID_LT(id, oldest_id))
 				oldest_id = id;
@@ -224,8 +244,15 @@ __wt_txn_refresh(WT_SESSION_IMPL *session, uint64_t max_id, int get_snapshot)
 		(void)WT_ATOMIC_SUB(txn_global->scan_count, 1);
 	}
 
-	if (get_snapshot)
+	if (get_snapshot) {
 		__txn_sort_snapshot(session, n, current_id);
+
+		WT_STAT_FAST_CONN_INCR(session, txn_snapshots);
+		WT_STAT_FAST_CONN_INCRV(session, txn_snapshot_states, scanned);
+		if (timed && __wt_epoch(session, &stop) == 0)
+			WT_STAT_FAST_CONN_INCRV(session,
+			    txn_snapshot_time, WT_TIMEDIFF(stop, start));
+	}
 }
 
 /*
@@ -247,6 +274,7 @@ __wt_txn_begin(WT_SESSION_IMPL *session, const char *cfg[])
 	txn_state = &txn_global->states[session->id];
 
 	WT_ASSERT(session, txn_state->id == WT_TXN_NONE);
+	__wt_txn_state_active(session);
 
 	WT_RET(__wt_config_gets_def(session, cfg, "isolation", 0, &cval));
 	if (cval.len == 0)
@@ -325,6 +353,7 @@ __wt_txn_release(WT_SESSION_IMPL *session)
 	 */
 	if (session->ncursors == 0)
 		__wt_txn_release_snapshot(session);
+	__wt_txn_state_idle(session);
 	txn->isolation = session->isolation;
 	F_CLR(txn, TXN_ERROR | TXN_OLDEST | TXN_RUNNING);
 }
@@ -501,6 +530,8 @@ __wt_txn_global_init(WT_CONNECTION_IMPL *conn, const char *cfg[])
 
 	WT_RET(__wt_calloc_def(
 	    session, conn->session_size, &txn_global->states));
+	WT_RET(__wt_calloc_def(
+	    session, (conn->session_size + 63) / 64, &txn_global->active));
 	for (i = 0, s = txn_global->states; i < conn->session_size; i++, s++)
 		s->id = s->snap_min = WT_TXN_NONE;
 
@@ -520,6 +551,8 @@ __wt_txn_global_destroy(WT_CONNECTION_IMPL *conn)
 	session = conn->default_session;
 	txn_global = &conn->txn_global;
 
-	if (txn_global != NULL)
+	if (txn_global != NULL) {
 		__wt_free(session, txn_global->states);
+		__wt_free(session, txn_global->active);
+	}
 }
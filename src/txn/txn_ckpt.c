@@ -59,13 +59,180 @@ err:	if (cursor != NULL)
 	return (ret);
 }
 
+/*
+ * WT_CKPT_WORK --
+ *	Files being processed by checkpoint worker threads.
+ */
+typedef struct {
+					/* Operation */
+	int (*op)(WT_SESSION_IMPL *, const char *[]);
+	const char **cfg;
+
+	WT_DATA_HANDLE **dhandle;	/* Referenced files */
+	size_t dhandle_alloc;
+	uint32_t count;			/* Number of files */
+	volatile uint32_t next;		/* Next file to process */
+
+	volatile int error;		/* First error */
+} WT_CKPT_WORK;
+
+/*
+ * WT_CKPT_THREAD --
+ *	A checkpoint worker thread.
+ */
+typedef struct {
+	WT_SESSION_IMPL *session;	/* Worker's session */
+	WT_CKPT_WORK *work;		/* Shared work */
+	pthread_t tid;			/* Worker thread */
+} WT_CKPT_THREAD;
+
+/*
+ * __checkpoint_work --
+ *	Process files until there are none left, or an error occurs.
+ */
+static int
+__checkpoint_work(WT_SESSION_IMPL *session, WT_CKPT_WORK *work)
+{
+	WT_DECL_RET;
+	uint32_t i;
+
+	while (work->error == 0 &&
+	    (i = WT_ATOMIC_ADD(work->next, 1) - 1) < work->count) {
+		WT_WITH_DHANDLE(session, work->dhandle[i],
+		    ret = work->op(session, work->cfg));
+		if (ret != 0) {
+			(void)WT_ATOMIC_CAS(work->error, 0, ret);
+			break;
+		}
+	}
+	return (ret);
+}
+
+/*
+ * __checkpoint_thread --
+ *	A checkpoint worker thread.
+ */
+static void *
+__checkpoint_thread(void *arg)
+{
+	WT_CKPT_THREAD *thread;
+	WT_SESSION_IMPL *session;
+
+	thread = arg;
+	session = thread->session;
+
+	/*
+	 * Worker threads only write leaf pages and flush files, both of which
+	 * are done at read-committed isolation.
+	 */
+	session->isolation = session->txn.isolation = TXN_ISO_READ_COMMITTED;
+
+	(void)__checkpoint_work(session, thread->work);
+	return (NULL);
+}
+
+/*
+ * __checkpoint_apply_parallel --
+ *	Apply an operation to all open files, using the checkpoint worker
+ * threads.
+ */
+static int
+__checkpoint_apply_parallel(WT_SESSION_IMPL *session,
+	int (*op)(WT_SESSION_IMPL *, const char *[]), const char *cfg[])
+{
+	WT_CKPT_THREAD *threads;
+	WT_CKPT_WORK work;
+	WT_CONNECTION_IMPL *conn;
+	WT_DATA_HANDLE *dhandle, *saved_dhandle;
+	WT_DECL_RET;
+	u_int i, nthreads, started;
+
+	conn = S2C(session);
+	saved_dhandle = session->dhandle;
+	threads = NULL;
+	started = 0;
+
+	WT_ASSERT(session, F_ISSET(session, WT_SESSION_SCHEMA_LOCKED));
+
+	WT_CLEAR(work);
+	work.op = op;
+	work.cfg = cfg;
+
+	/*
+	 * Get a reference to each of the open files, as __wt_conn_btree_apply
+	 * does.  The references are held by our session until every file has
+	 * been processed, the worker threads use the handles without locking
+	 * them.  Files being bulk-loaded can't be referenced, there are never
+	 * many of them, process them here.
+	 */
+	SLIST_FOREACH(dhandle, &conn->dhlh, l) {
+		if (!F_ISSET(dhandle, WT_DHANDLE_OPEN) ||
+		    !WT_PREFIX_MATCH(dhandle->name, "file:") ||
+		    dhandle->checkpoint != NULL || WT_IS_METADATA(dhandle))
+			continue;
+
+		WT_ERR(__wt_realloc_def(session,
+		    &work.dhandle_alloc, work.count + 1, &work.dhandle));
+		ret = __wt_session_get_btree(
+		    session, dhandle->name, NULL, NULL, 0);
+		if (ret == 0)
+			work.dhandle[work.count++] = session->dhandle;
+		else if (ret == EBUSY)
+			ret = __wt_conn_btree_apply_single(
+			    session, dhandle->name, NULL, op, cfg);
+		WT_ERR(ret);
+	}
+
+	/*
+	 * Start the worker threads, there's no point in starting more threads
+	 * than there are files for them to process, then do our share of the
+	 * work.
+	 */
+	nthreads = 0;
+	if (work.count > 1)
+		nthreads = WT_MIN(conn->ckpt_threads, work.count - 1);
+	if (nthreads != 0) {
+		WT_ERR(__wt_calloc_def(session, nthreads, &threads));
+		for (; started < nthreads; ++started) {
+			threads[started].session =
+			    conn->ckpt_worker_session[started];
+			threads[started].work = &work;
+			WT_ERR(__wt_thread_create(session,
+			    &threads[started].tid,
+			    __checkpoint_thread, &threads[started]));
+		}
+	}
+	WT_ERR(__checkpoint_work(session, &work));
+
+err:	/* Stop the worker threads taking more work, and wait for them. */
+	if (ret != 0)
+		(void)WT_ATOMIC_CAS(work.error, 0, ret);
+	for (i = 0; i < started; i++)
+		WT_TRET(__wt_thread_join(session, threads[i].tid));
+	WT_TRET(work.error);
+
+	/* Release the files, as __wt_conn_btree_apply does. */
+	for (i = 0; i < work.count; i++) {
+		session->dhandle = work.dhandle[i];
+		if (WT_META_TRACKING(session))
+			WT_TRET(__wt_meta_track_handle_lock(session, 0));
+		else
+			WT_TRET(__wt_session_release_btree(session));
+	}
+	session->dhandle = saved_dhandle;
+
+	__wt_free(session, threads);
+	__wt_free(session, work.dhandle);
+	return (ret);
+}
+
 /*
  * __checkpoint_apply --
  *	Apply an operation to all files involved in a checkpoint.
  */
 static int
 __checkpoint_apply(WT_SESSION_IMPL *session, const char *cfg[],
-	int (*op)(WT_SESSION_IMPL *, const char *[]), int *fullp)
+	int (*op)(WT_SESSION_IMPL *, const char *[]), int parallel, int *fullp)
 {
 	WT_CONFIG targetconf;
 	WT_CONFIG_ITEM cval, k, v;
@@ -126,9 +293,12 @@ __checkpoint_apply(WT_SESSION_IMPL *session, const char *cfg[],
 			WT_ERR(__wt_config_gets(session, cfg, "drop", &cval));
 			ckpt_closed = cval.len != 0;
 		}
-		WT_ERR(ckpt_closed ?
-		    __wt_meta_btree_apply(session, op, cfg) :
-		    __wt_conn_btree_apply(session, 0, op, cfg));
+		if (ckpt_closed)
+			WT_ERR(__wt_meta_btree_apply(session, op, cfg));
+		else if (parallel && S2C(session)->ckpt_threads != 0)
+			WT_ERR(__checkpoint_apply_parallel(session, op, cfg));
+		else
+			WT_ERR(__wt_conn_btree_apply(session, 0, op, cfg));
 	}
 
 err:	__wt_scr_free(&tmp);
@@ -216,10 +386,17 @@ __wt_txn_checkpoint(WT_SESSION_IMPL *session, const char *cfg[])
 	/* Flush data-sources before we start the checkpoint. */
 	WT_ERR(__checkpoint_data_source(session, cfg));
 
-	/* Flush dirty leaf pages before we start the checkpoint. */
+	/*
+	 * Flush dirty leaf pages before we start the checkpoint.
+	 *
+	 * Writing leaf pages and flushing files can be done by the checkpoint
+	 * worker threads, if configured.  Checkpointing the files updates the
+	 * metadata, which is tracked by our session so the checkpoint is
+	 * resolved atomically, and is always done here.
+	 */
 	session->isolation = txn->isolation = TXN_ISO_READ_COMMITTED;
 	WT_ERR(__checkpoint_apply(
-	    session, cfg, __wt_checkpoint_write_leaves, &full));
+	    session, cfg, __wt_checkpoint_write_leaves, 1, &full));
 
 	WT_ERR(__wt_meta_track_on(session));
 	tracking = 1;
@@ -240,7 +417,7 @@ __wt_txn_checkpoint(WT_SESSION_IMPL *session, const char *cfg[])
 		started = 1;
 	}
 
-	WT_ERR(__checkpoint_apply(session, cfg, __wt_checkpoint, NULL));
+	WT_ERR(__checkpoint_apply(session, cfg, __wt_checkpoint, 0, NULL));
 
 	/* Release the snapshot transaction, before syncing the file(s). */
 	__wt_txn_release(session);
@@ -251,7 +428,7 @@ __wt_txn_checkpoint(WT_SESSION_IMPL *session, const char *cfg[])
 	 */
 	if (F_ISSET(conn, WT_CONN_CKPT_SYNC))
 		WT_ERR(__checkpoint_apply(
-		    session, cfg, __wt_checkpoint_sync, NULL));
+		    session, cfg, __wt_checkpoint_sync, 1, NULL));
 
 	/* Checkpoint the metadata file. */
 	SLIST_FOREACH(dhandle, &conn->dhlh, l) {
@@ -7,6 +7,16 @@
 
 #include "wt_internal.h"
 
+/*
+ * The log scan hands operations to the recovery worker threads in batches, and
+ * limits the bytes queued for a worker, waiting for the worker to catch up.
+ */
+#define	WT_RECOVERY_BATCH_MAX	(64 * 1024)
+#define	WT_RECOVERY_QUEUE_MAX	(4 * WT_MEGABYTE)
+
+typedef struct __recovery_op WT_RECOVERY_OP;
+typedef struct __recovery_worker WT_RECOVERY_WORKER;
+
 /* State maintained during recovery. */
 typedef struct {
 	WT_SESSION_IMPL *session;
@@ -28,8 +38,44 @@ typedef struct {
 					 * Set during the first recovery pass,
 					 * when only the metadata is recovered.
 					 */
+
+	WT_RECOVERY_WORKER *workers;	/* Worker threads applying operations */
+	u_int nworkers;
+	WT_CONDVAR *scan_cond;		/* Log scan waiting for the workers */
 } WT_RECOVERY;
 
+/* An operation queued for a recovery worker thread. */
+struct __recovery_op {
+	TAILQ_ENTRY(__recovery_op) q;
+
+	WT_LSN	 lsn;			/* Commit record's LSN */
+	uint32_t size;			/* Operation size, data follows */
+};
+
+/*
+ * A recovery worker thread: each file is recovered by a single worker, so
+ * operations on a file are applied in log order, the worker's own recovery
+ * state has the worker's session and cursors.
+ */
+struct __recovery_worker {
+	WT_RECOVERY r;			/* Worker's recovery state */
+
+	pthread_t tid;			/* Worker thread */
+	int	  tid_set;
+
+	WT_SPINLOCK lock;		/* Queue lock */
+	WT_CONDVAR *cond;		/* Worker waiting for operations */
+	TAILQ_HEAD(__recovery_qh, __recovery_op) qh;
+	size_t	  queued;		/* Bytes queued */
+	int	  done;			/* No more operations will be queued */
+
+					/* Log scan's batch, not yet queued */
+	struct __recovery_qh batch;
+	size_t	  batch_size;
+
+	int	  error;		/* First error applying operations */
+};
+
 /*
  * __recovery_cursor --
  *	Get a cursor for a recovery operation.
@@ -87,7 +133,8 @@ __recovery_cursor(WT_SESSION_IMPL *session, WT_RECOVERY *r,
 	    (cursor == NULL) ? "Skipping" : "Applying",			\
 	    optype, fileid, lsnp->file, (uintmax_t)lsnp->offset);	\
 	if (cursor == NULL)						\
-		break
+		break;							\
+	WT_STAT_FAST_CONN_INCR((session), txn_recover_ops)
 
 /*
  * __txn_op_apply --
@@ -227,6 +274,83 @@ err:	if (ret != 0)
 	return (ret);
 }
 
+/*
+ * __txn_op_batch_queue --
+ *	Queue the log scan's batch of operations for a worker thread.
+ */
+static int
+__txn_op_batch_queue(WT_RECOVERY *r, WT_RECOVERY_WORKER *w)
+{
+	WT_SESSION_IMPL *session;
+	int wake;
+
+	session = r->session;
+
+	if (TAILQ_EMPTY(&w->batch))
+		return (0);
+
+	/* Wait for the worker if it has too much work queued. */
+	while (w->queued > WT_RECOVERY_QUEUE_MAX && w->error == 0)
+		WT_RET_TIMEDOUT_OK(
+		    __wt_cond_wait(session, r->scan_cond, 10000));
+	if (w->error != 0)
+		return (w->error);
+
+	__wt_spin_lock(session, &w->lock);
+	wake = TAILQ_EMPTY(&w->qh);
+	TAILQ_CONCAT(&w->qh, &w->batch, q);
+	w->queued += w->batch_size;
+	__wt_spin_unlock(session, &w->lock);
+	w->batch_size = 0;
+
+	/* The worker only sleeps when its queue is empty. */
+	return (wake ? __wt_cond_signal(session, w->cond) : 0);
+}
+
+/*
+ * __txn_op_queue --
+ *	Queue a transactional operation for the worker thread recovering its
+ * file.
+ */
+static int
+__txn_op_queue(
+    WT_RECOVERY *r, WT_LSN *lsnp, const uint8_t **pp, const uint8_t *end)
+{
+	WT_RECOVERY_OP *op;
+	WT_RECOVERY_WORKER *w;
+	WT_SESSION_IMPL *session;
+	uint32_t fileid, optype, opsize;
+
+	session = r->session;
+
+	/*
+	 * Peek at the type, the size and the file ID: every operation starts
+	 * with the file ID.
+	 */
+	WT_RET(__wt_struct_unpack(session, *pp, WT_PTRDIFF(end, *pp),
+	    "III", &optype, &opsize, &fileid));
+	if (opsize > WT_PTRDIFF(end, *pp))
+		WT_RET_MSG(session, WT_ERROR,
+		    "Operation at LSN %u/%" PRIuMAX " overruns its record",
+		    lsnp->file, (uintmax_t)lsnp->offset);
+
+	w = &r->workers[fileid % r->nworkers];
+	if (w->error != 0)
+		return (w->error);
+
+	WT_RET(__wt_calloc(session, 1, sizeof(WT_RECOVERY_OP) + opsize, &op));
+	op->lsn = *lsnp;
+	op->size = opsize;
+	memcpy(op + 1, *pp, opsize);
+	*pp += opsize;
+
+	TAILQ_INSERT_TAIL(&w->batch, op, q);
+	w->batch_size += opsize;
+	if (w->batch_size >= WT_RECOVERY_BATCH_MAX)
+		WT_RET(__txn_op_batch_queue(r, w));
+	return (0);
+}
+
 /*
  * __txn_commit_apply --
  *	Apply a commit record during recovery.
@@ -235,15 +359,85 @@ static int
 __txn_commit_apply(
     WT_RECOVERY *r, WT_LSN *lsnp, const uint8_t **pp, const uint8_t *end)
 {
-	WT_UNUSED(lsnp);
-
 	/* The logging subsystem zero-pads records. */
 	while (*pp < end && **pp)
-		WT_RET(__txn_op_apply(r, lsnp, pp, end));
+		if (r->nworkers != 0)
+			WT_RET(__txn_op_queue(r, lsnp, pp, end));
+		else
+			WT_RET(__txn_op_apply(r, lsnp, pp, end));
 
 	return (0);
 }
 
+/*
+ * __recovery_worker --
+ *	A recovery worker thread, applying the operations queued for it.
+ */
+static void *
+__recovery_worker(void *arg)
+{
+	struct __recovery_qh qh;
+	WT_DECL_RET;
+	WT_RECOVERY *r;
+	WT_RECOVERY_OP *op;
+	WT_RECOVERY_WORKER *w;
+	WT_SESSION_IMPL *session;
+	size_t applied;
+	const uint8_t *p;
+	int done, wake;
+
+	w = arg;
+	r = &w->r;
+	session = r->session;
+	TAILQ_INIT(&qh);
+
+	for (;;) {
+		/* Take everything queued. */
+		__wt_spin_lock(session, &w->lock);
+		TAILQ_CONCAT(&qh, &w->qh, q);
+		done = w->done;
+		__wt_spin_unlock(session, &w->lock);
+
+		if (TAILQ_EMPTY(&qh)) {
+			if (done)
+				break;
+			if ((ret = __wt_cond_wait(
+			    session, w->cond, 10000)) == ETIMEDOUT)
+				ret = 0;
+			if (ret != 0 && w->error == 0)
+				w->error = ret;
+			continue;
+		}
+
+		/*
+		 * Once an operation fails, discard the rest of the queue so
+		 * the log scan isn't left waiting for us, it stops when it
+		 * sees the error.
+		 */
+		for (applied = 0; (op = TAILQ_FIRST(&qh)) != NULL;) {
+			TAILQ_REMOVE(&qh, op, q);
+			p = (const uint8_t *)(op + 1);
+			if (w->error == 0)
+				w->error = __txn_op_apply(
+				    r, &op->lsn, &p, p + op->size);
+			applied += op->size;
+			__wt_free(session, op);
+		}
+
+		__wt_spin_lock(session, &w->lock);
+		wake = w->queued > WT_RECOVERY_QUEUE_MAX;
+		w->queued -= applied;
+		wake = wake && w->queued <= WT_RECOVERY_QUEUE_MAX;
+		__wt_spin_unlock(session, &w->lock);
+
+		if (wake && (ret = __wt_cond_signal(
+		    session, r->scan_cond)) != 0 && w->error == 0)
+			w->error = ret;
+	}
+
+	return (NULL);
+}
+
 /*
  * __txn_log_recover --
  *	Roll the log forward to recover committed changes.
@@ -263,6 +457,7 @@ __txn_log_recover(
 
 	/* First, peek at the log record type. */
 	WT_RET(__wt_logrec_read(session, &p, end, &rectype));
+	WT_STAT_FAST_CONN_SET(session, txn_recover_file, lsnp->file);
 
 	switch (rectype) {
 	case WT_LOGREC_CHECKPOINT:
@@ -345,6 +540,120 @@ __recovery_free(WT_RECOVERY *r)
 	return (ret);
 }
 
+/*
+ * __recovery_workers_start --
+ *	Start the worker threads applying operations for the main recovery
+ * pass.
+ */
+static int
+__recovery_workers_start(WT_RECOVERY *r, u_int nworkers)
+{
+	WT_RECOVERY_WORKER *w;
+	WT_SESSION_IMPL *session;
+	u_int i, j;
+
+	session = r->session;
+
+	WT_RET(__wt_cond_alloc(session, "recovery scan", 0, &r->scan_cond));
+	WT_RET(__wt_calloc_def(session, nworkers, &r->workers));
+	r->nworkers = nworkers;
+
+	for (i = 0; i < nworkers; i++) {
+		w = &r->workers[i];
+		TAILQ_INIT(&w->qh);
+		TAILQ_INIT(&w->batch);
+		WT_RET(__wt_spin_init(session, &w->lock, "recovery worker"));
+		WT_RET(__wt_cond_alloc(
+		    session, "recovery worker", 0, &w->cond));
+
+		/*
+		 * Each worker gets its own session, and its own copy of the
+		 * file information for its cursors.
+		 */
+		WT_RET(__wt_open_session(
+		    S2C(session), 1, NULL, NULL, &w->r.session));
+		w->r.session->name = "recovery-worker";
+		F_SET(w->r.session, WT_SESSION_LOGGING_DISABLED);
+		WT_RET(__wt_calloc_def(session, r->nfiles, &w->r.files));
+		for (j = 0; j < r->nfiles; j++) {
+			w->r.files[j].uri = r->files[j].uri;
+			w->r.files[j].ckpt_lsn = r->files[j].ckpt_lsn;
+		}
+		w->r.nfiles = r->nfiles;
+		w->r.max_fileid = r->max_fileid;
+		w->r.ckpt_lsn = r->ckpt_lsn;
+
+		WT_RET(__wt_thread_create(
+		    session, &w->tid, __recovery_worker, w));
+		w->tid_set = 1;
+	}
+
+	return (0);
+}
+
+/*
+ * __recovery_workers_stop --
+ *	Wait for the recovery worker threads to apply everything queued for
+ * them, and shut them down.
+ */
+static int
+__recovery_workers_stop(WT_RECOVERY *r)
+{
+	WT_CURSOR *c;
+	WT_DECL_RET;
+	WT_RECOVERY_OP *op;
+	WT_RECOVERY_WORKER *w;
+	WT_SESSION_IMPL *session;
+	u_int i, j;
+
+	session = r->session;
+
+	for (i = 0; i < r->nworkers; i++) {
+		w = &r->workers[i];
+		if (w->tid_set) {
+			WT_TRET(__txn_op_batch_queue(r, w));
+			__wt_spin_lock(session, &w->lock);
+			w->done = 1;
+			__wt_spin_unlock(session, &w->lock);
+			WT_TRET(__wt_cond_signal(session, w->cond));
+			WT_TRET(__wt_thread_join(session, w->tid));
+			w->tid_set = 0;
+		}
+		WT_TRET(w->error);
+
+		/* Gather the results. */
+		if (w->r.modified)
+			r->modified = 1;
+		if (w->r.max_fileid > r->max_fileid)
+			r->max_fileid = w->r.max_fileid;
+
+		/* Anything still queued was never applied. */
+		TAILQ_CONCAT(&w->qh, &w->batch, q);
+		while ((op = TAILQ_FIRST(&w->qh)) != NULL) {
+			TAILQ_REMOVE(&w->qh, op, q);
+			__wt_free(session, op);
+		}
+
+		/* The file URIs belong to the main recovery state. */
+		if (w->r.files != NULL)
+			for (j = 0; j < w->r.nfiles; j++)
+				if ((c = w->r.files[j].c) != NULL)
+					WT_TRET(c->close(c));
+		__wt_free(session, w->r.files);
+		if (w->r.session != NULL)
+			WT_TRET(w->r.session->iface.close(
+			    &w->r.session->iface, NULL));
+
+		WT_TRET(__wt_cond_destroy(session, &w->cond));
+		__wt_spin_destroy(session, &w->lock);
+	}
+
+	__wt_free(session, r->workers);
+	r->nworkers = 0;
+	WT_TRET(__wt_cond_destroy(session, &r->scan_cond));
+	return (ret);
+}
+
 /*
  * __recovery_file_scan --
  *	Scan the files referenced from the metadata and gather information
@@ -424,8 +733,15 @@ __wt_txn_recover(WT_SESSION_IMPL *default_session)
 	/*
 	 * Now, recover all the files apart from the metadata.
 	 * Pass WT_LOGSCAN_RECOVER so that old logs get truncated.
+	 *
+	 * If configured, the log scan queues the operations for worker
+	 * threads that apply them in parallel, each file's operations in log
+	 * order.
 	 */
 	r.metadata_only = 0;
+	if (conn->log_recovery_threads != 0)
+		WT_ERR(__recovery_workers_start(
+		    &r, conn->log_recovery_threads));
 	WT_VERBOSE_ERR(session, recovery,
 	    "Main recovery loop: starting at %u/%" PRIuMAX,
 	    r.ckpt_lsn.file, (uintmax_t)r.ckpt_lsn.offset);
@@ -438,9 +754,11 @@ __wt_txn_recover(WT_SESSION_IMPL *default_session)
 		    WT_LOGSCAN_RECOVER,
 		    __txn_log_recover, &r));
 
+	WT_ERR(__recovery_workers_stop(&r));
 	conn->next_file_id = r.max_fileid;
 
-err:	modified = r.modified;
+err:	WT_TRET(__recovery_workers_stop(&r));
+	modified = r.modified;
 	WT_TRET(__recovery_free(&r));
 	__wt_free(session, config);
 	WT_TRET(session->iface.close(&session->iface, NULL));
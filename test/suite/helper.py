@@ -95,6 +95,14 @@ def confirm_empty(self, uri):
         self.assertEqual(cursor.next(), wiredtiger.WT_NOTFOUND)
     cursor.close()
 
+# Return the value of a statistic, from the connection's statistics or, given
+# a URI, from the object's statistics.
+def stat_value(self, which, uri=''):
+    statcursor = self.session.open_cursor('statistics:' + uri, None, None)
+    value = statcursor[which][2]
+    statcursor.close()
+    return value
+
 # create a simple_populate or complex_populate key
 def key_populate(cursor, i):
     key_format = cursor.key_format
@@ -0,0 +1,101 @@
+#!/usr/bin/env python
+#
+# Public Domain 2008-2013 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import Queue
+import threading, wiredtiger, wttest
+from helper import complex_populate, complex_populate_check, \
+    simple_populate, simple_populate_check, stat_value
+from wiredtiger import stat
+from wtthread import checkpoint_thread, op_thread
+
+# test_async_io01.py
+#    Asynchronous block writes
+class test_async_io01(wttest.WiredTigerTestCase):
+    nentries = 10000
+    conn_config = 'cache_size=1MB,statistics=(fast),' + \
+        'async_io=(enabled=true,queue_depth=4)'
+    scenarios = [
+        ('file', dict(uri='file:async_io', populate=simple_populate,
+            check=simple_populate_check)),
+        ('table', dict(uri='table:async_io', populate=complex_populate,
+            check=complex_populate_check)),
+        ]
+
+    # Write enough blocks to force eviction, checkpoint and re-open, then
+    # check the object.
+    def test_async_io(self):
+        self.populate(self, self.uri, 'leaf_page_max=4KB', self.nentries)
+        self.session.checkpoint()
+
+        self.assertGreater(stat_value(self, stat.conn.block_write_async), 0)
+
+        self.reopen_conn()
+        self.check(self, self.uri, self.nentries)
+        self.session.verify(self.uri)
+
+    # Insert from several threads while another thread checkpoints, so
+    # threads start writes while others wait for writes to complete, then
+    # checkpoint, re-open and check the object.
+    def test_async_io_threads(self):
+        nthreads = 4
+        uri = self.uri + '_threads'
+        value = 'abcdefghij' * 10
+        self.session.create(uri, 'key_format=r,value_format=S')
+
+        done = threading.Event()
+        queue = Queue.Queue()
+        for i in xrange(1, self.nentries + 1):
+            queue.put_nowait(('i', i, value + str(i)))
+        ckpt = checkpoint_thread(self.conn, done)
+        ckpt.start()
+        opthreads = []
+        for i in xrange(nthreads):
+            t = op_thread(self.conn, [uri], 'r', queue, done)
+            opthreads.append(t)
+            t.start()
+        queue.join()
+        done.set()
+        for t in opthreads:
+            t.join()
+        ckpt.join()
+        self.session.checkpoint()
+
+        self.assertGreater(stat_value(self, stat.conn.block_write_async), 0)
+
+        self.reopen_conn()
+        cursor = self.session.open_cursor(uri, None, None)
+        i = 0
+        for key, v in cursor:
+            i += 1
+            self.assertEqual(key, i)
+            self.assertEqual(v, value + str(i))
+        self.assertEqual(i, self.nentries)
+        cursor.close()
+        self.session.verify(uri)
+
+if __name__ == '__main__':
+    wttest.run()
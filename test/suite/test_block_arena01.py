@@ -0,0 +1,115 @@
+#!/usr/bin/env python
+#
+# Public Domain 2008-2013 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+
+import Queue
+import os, threading, wiredtiger, wttest
+from wtthread import checkpoint_thread, op_thread
+
+# test_block_arena01.py
+#    Blocks written by concurrent threads are allocated from per-file
+#    allocation arenas; the space the arenas hold is returned to the file.
+class test_block_arena01(wttest.WiredTigerTestCase):
+    nentries = 20000
+    nthreads = 4
+    conn_config = 'cache_size=1MB'
+    scenarios = [
+        ('file', dict(uri='file:arena', filename='arena')),
+        ('table', dict(uri='table:arena', filename='arena.wt'))
+        ]
+
+    def key(self, i):
+        return str(i).zfill(10)
+
+    def value(self, i, generation):
+        return str(generation) + ':' + str(i).zfill(100)
+
+    # Insert every record from several threads, each with its own session,
+    # while another thread checkpoints.
+    def load(self, generation):
+        done = threading.Event()
+        queue = Queue.Queue()
+        for i in xrange(self.nentries):
+            queue.put_nowait(('i', self.key(i), self.value(i, generation)))
+        ckpt = checkpoint_thread(self.conn, done)
+        ckpt.start()
+        opthreads = []
+        for i in xrange(self.nthreads):
+            t = op_thread(self.conn, [self.uri], 'S', queue, done)
+            opthreads.append(t)
+            t.start()
+        queue.join()
+        done.set()
+        for t in opthreads:
+            t.join()
+        ckpt.join()
+
+    def check(self, generation):
+        cursor = self.session.open_cursor(self.uri, None, None)
+        i = 0
+        for key, value in cursor:
+            self.assertEqual(key, self.key(i))
+            self.assertEqual(value, self.value(i, generation))
+            i += 1
+        self.assertEqual(i, self.nentries)
+        cursor.close()
+
+    # Load and then overwrite the object from concurrent threads, checking
+    # the object after each checkpoint and re-open: verify fails if space
+    # held by an arena when a checkpoint was written is missing from the
+    # checkpoint's free lists.  Then remove the records and compact the
+    # object: the file shrinks only if all of the space was returned.
+    def test_block_arena(self):
+        self.session.create(self.uri, 'key_format=S,value_format=S')
+        self.load(1)
+        self.session.checkpoint()
+        self.session.verify(self.uri)
+        self.check(1)
+
+        self.load(2)
+        self.session.checkpoint()
+        self.session.verify(self.uri)
+        self.reopen_conn()
+        self.check(2)
+        self.session.verify(self.uri)
+
+        start = self.session.open_cursor(self.uri, None, None)
+        start.set_key(self.key(0))
+        stop = self.session.open_cursor(self.uri, None, None)
+        stop.set_key(self.key(self.nentries - 1))
+        self.session.truncate(None, start, stop, None)
+        start.close()
+        stop.close()
+        self.session.checkpoint()
+        self.session.checkpoint()
+        self.session.compact(self.uri, None)
+        self.reopen_conn()
+        self.session.verify(self.uri)
+        self.assertLess(os.path.getsize(self.filename), 64 * 1024)
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,87 @@
+#!/usr/bin/env python
+#
+# Public Domain 2008-2013 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import wiredtiger, wttest
+from helper import key_populate, simple_populate, simple_populate_check, \
+    stat_value
+from wiredtiger import stat
+
+# test_block_cache01.py
+#    Clean pages evicted from the cache are re-read from the block cache
+class test_block_cache01(wttest.WiredTigerTestCase):
+    nentries = 50000
+    config = 'leaf_page_max=4KB,'
+    conn_config = 'cache_size=1MB,block_cache=(size=50MB),statistics=(fast)'
+    scenarios = [
+        ('file-r', dict(type='file:', keyfmt='r')),
+        ('file-S', dict(type='file:', keyfmt='S')),
+        ('table-r', dict(type='table:', keyfmt='r')),
+        ('table-S', dict(type='table:', keyfmt='S'))
+        ]
+
+    # Read an object larger than the cache twice: the second read should
+    # find pages in the block cache.
+    def test_block_cache(self):
+        uri = self.type + 'block_cache'
+        simple_populate(self, uri,
+            self.config + 'key_format=' + self.keyfmt, self.nentries)
+        self.reopen_conn()
+
+        simple_populate_check(self, uri, self.nentries)
+        self.assertGreater(stat_value(self, stat.conn.block_cache_insert), 0)
+        simple_populate_check(self, uri, self.nentries)
+        self.assertGreater(stat_value(self, stat.conn.block_cache_hit), 0)
+
+    # Update an object after its pages were cached: reads must return the
+    # new values, not cached images of the old blocks.
+    def test_block_cache_update(self):
+        uri = self.type + 'block_cache'
+        simple_populate(self, uri,
+            self.config + 'key_format=' + self.keyfmt, self.nentries)
+        self.reopen_conn()
+        simple_populate_check(self, uri, self.nentries)
+
+        cursor = self.session.open_cursor(uri, None, None)
+        for i in range(1, self.nentries + 1, 3):
+            cursor.set_key(key_populate(cursor, i))
+            cursor.set_value(str(i) + ': updated')
+            cursor.update()
+        cursor.close()
+        self.session.checkpoint()
+
+        cursor = self.session.open_cursor(uri, None, None)
+        i = 0
+        for key, value in cursor:
+            i += 1
+            if i % 3 == 1:
+                self.assertEqual(value, str(i) + ': updated')
+        self.assertEqual(i, self.nentries)
+        cursor.close()
+        self.session.verify(uri)
+
+if __name__ == '__main__':
+    wttest.run()
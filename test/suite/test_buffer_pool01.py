@@ -0,0 +1,57 @@
+#!/usr/bin/env python
+#
+# Public Domain 2008-2013 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import wiredtiger, wttest
+from helper import simple_populate, simple_populate_check, stat_value
+from wiredtiger import stat
+
+# test_buffer_pool01.py
+#    I/O buffers are returned to the buffer pool and re-used
+class test_buffer_pool01(wttest.WiredTigerTestCase):
+    nentries = 50000
+    conn_config = 'cache_size=1MB,buffer_pool=(size=10MB),statistics=(fast)'
+    scenarios = [
+        ('file', dict(type='file:')),
+        ('table', dict(type='table:'))
+        ]
+
+    # Read an object larger than the cache: the disk images of evicted
+    # pages go back to the pool and are re-used for later reads.
+    def test_buffer_pool(self):
+        uri = self.type + 'buffer_pool'
+        simple_populate(self, uri,
+            'leaf_page_max=4KB,key_format=S', self.nentries)
+        self.reopen_conn()
+
+        simple_populate_check(self, uri, self.nentries)
+        self.assertGreater(stat_value(self, stat.conn.buffer_pool_reuse), 0)
+        self.assertLessEqual(
+            stat_value(self, stat.conn.buffer_pool_bytes), 10 * 1024 * 1024)
+        self.session.verify(uri)
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,79 @@
+#!/usr/bin/env python
+#
+# Public Domain 2008-2013 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+
+import wiredtiger, wttest
+from helper import stat_value
+from wtscenario import multiply_scenarios, number_scenarios
+from wiredtiger import stat
+
+# test_cache01.py
+#    Repeatedly updating a key with large values: obsolete updates are freed
+#    as the page is updated, and page memory stays bounded without the page
+#    being written by eviction.
+class test_cache01(wttest.WiredTigerTestCase):
+    cache_size = 10 * 1024 * 1024
+    nupdates = 30000
+    conn_config = 'cache_size=10MB,statistics=(fast)'
+    types = [
+        ('file', dict(uri='file:cache')),
+        ('table', dict(uri='table:cache'))
+        ]
+    values = [
+        ('1KB', dict(valuelen=1000)),
+        ('20KB', dict(valuelen=20000)),
+        ]
+    scenarios = number_scenarios(multiply_scenarios('.', types, values))
+
+    def value(self, i):
+        v = str(i) + ': '
+        return v + 'a' * (self.valuelen - len(v))
+
+    def test_cache_large_updates(self):
+        self.session.create(self.uri, 'key_format=S,value_format=S')
+        cursor = self.session.open_cursor(self.uri, None, None)
+        for i in range(self.nupdates):
+            cursor.set_key('key')
+            cursor.set_value(self.value(i))
+            cursor.insert()
+            if i % 1000 == 0:
+                self.assertLess(stat_value(self,
+                    stat.conn.cache_bytes_inuse), self.cache_size)
+        cursor.close()
+        self.assertLess(
+            stat_value(self, stat.conn.cache_bytes_inuse), self.cache_size)
+        self.assertEqual(stat_value(self, stat.conn.cache_eviction_dirty), 0)
+
+        cursor = self.session.open_cursor(self.uri, None, None)
+        cursor.set_key('key')
+        self.assertEqual(cursor.search(), 0)
+        self.assertEqual(cursor.get_value(), self.value(self.nupdates - 1))
+        cursor.close()
+        self.session.verify(self.uri)
+
+if __name__ == '__main__':
+    wttest.run()
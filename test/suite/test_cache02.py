@@ -0,0 +1,64 @@
+#!/usr/bin/env python
+#
+# Public Domain 2008-2013 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+
+import wiredtiger, wttest
+from helper import simple_populate, simple_populate_check, stat_value
+from wiredtiger import stat
+
+# test_cache02.py
+#    Eviction worker threads: loading a table larger than the cache, pages
+#    are evicted by the worker threads and each worker's count is reported.
+class test_cache02(wttest.WiredTigerTestCase):
+    nentries = 100000
+    conn_config = 'cache_size=2MB,eviction=(threads_min=3,threads_max=3),' + \
+        'statistics=(fast)'
+    scenarios = [
+        ('file', dict(uri='file:cache')),
+        ('table', dict(uri='table:cache'))
+        ]
+
+    def test_cache_eviction_workers(self):
+        simple_populate(self, self.uri,
+            'key_format=S,leaf_page_max=4KB', self.nentries)
+
+        # Read the table back to force clean pages out as well.
+        simple_populate_check(self, self.uri, self.nentries)
+
+        self.assertEqual(stat_value(self, stat.conn.cache_eviction_workers), 2)
+        evicted = stat_value(self, stat.conn.cache_eviction_worker_evicting)
+        evicted_max = stat_value(self,
+            stat.conn.cache_eviction_worker_evicting_max)
+        evicted_min = stat_value(self,
+            stat.conn.cache_eviction_worker_evicting_min)
+        self.assertGreater(evicted, 0)
+        self.assertGreater(evicted_max, 0)
+        self.assertLessEqual(evicted_min, evicted_max)
+        self.assertLessEqual(evicted_min + evicted_max, evicted)
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,105 @@
+#!/usr/bin/env python
+#
+# Public Domain 2008-2013 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import wiredtiger, wttest
+from helper import key_populate, simple_populate, simple_populate_check, \
+    value_populate
+
+# test_checkpoint03.py
+#    Checkpoints written by checkpoint worker threads
+class test_checkpoint03(wttest.WiredTigerTestCase):
+    nentries = 1000
+    nobjects = 20
+    conn_config = 'checkpoint=(threads=4)'
+    scenarios = [
+        ('file', dict(uri='file:checkpoint')),
+        ('table', dict(uri='table:checkpoint')),
+        ]
+
+    def update(self, uri, value):
+        cursor = self.session.open_cursor(uri, None)
+        for i in range(1, self.nentries + 1):
+            cursor.set_key(key_populate(cursor, i))
+            cursor.set_value(value)
+            cursor.update()
+        cursor.close()
+
+    def check(self, uri, checkpoint, value):
+        cursor = self.session.open_cursor(uri, None, checkpoint)
+        i = 0
+        for key, v in cursor:
+            i += 1
+            self.assertEqual(key, key_populate(cursor, i))
+            self.assertEqual(v, value)
+        self.assertEqual(i, self.nentries)
+        cursor.close()
+
+    # Checkpoint many objects, and confirm each object's checkpoint has the
+    # values written before the checkpoint, and none written after it.
+    def test_checkpoint_threads(self):
+        uris = [self.uri + str(i) for i in range(self.nobjects)]
+        for uri in uris:
+            simple_populate(self, uri, 'key_format=S', self.nentries)
+        self.session.checkpoint()
+        for uri in uris:
+            self.update(uri, 'before')
+        self.session.checkpoint()
+        for uri in uris:
+            self.update(uri, 'after')
+
+        for uri in uris:
+            self.check(uri, 'checkpoint=WiredTigerCheckpoint', 'before')
+            self.check(uri, None, 'after')
+
+        self.reopen_conn()
+        for uri in uris:
+            self.check(uri, None, 'before')
+            self.session.verify(uri)
+
+    # Files being bulk-loaded are checkpointed by the thread taking the
+    # checkpoint, not the worker threads.
+    def test_checkpoint_threads_bulk(self):
+        uris = [self.uri + str(i) for i in range(self.nobjects)]
+        for uri in uris:
+            simple_populate(self, uri, 'key_format=S', self.nentries)
+        bulk_uri = self.uri + 'bulk'
+        self.session.create(bulk_uri, 'key_format=S,value_format=S')
+        cursor = self.session.open_cursor(bulk_uri, None, 'bulk')
+        for i in range(1, self.nentries + 1):
+            cursor.set_key(key_populate(cursor, i))
+            cursor.set_value(value_populate(cursor, i))
+            cursor.insert()
+        self.session.checkpoint()
+        cursor.close()
+
+        self.reopen_conn()
+        for uri in uris:
+            simple_populate_check(self, uri, self.nentries)
+        simple_populate_check(self, bulk_uri, self.nentries)
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,66 @@
+#!/usr/bin/env python
+#
+# Public Domain 2008-2013 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import time
+import wiredtiger, wttest
+from helper import key_populate, simple_populate, stat_value
+from wiredtiger import stat
+
+# test_checkpoint04.py
+#    Incremental checkpoints write dirty pages between checkpoints
+class test_checkpoint04(wttest.WiredTigerTestCase):
+    nentries = 10000
+    conn_config = 'checkpoint=(wait=1,incremental=true),statistics=(fast)'
+    scenarios = [
+        ('file', dict(uri='file:checkpoint')),
+        ('table', dict(uri='table:checkpoint')),
+        ]
+
+    def incremental_bytes(self):
+        return stat_value(self, stat.conn.txn_checkpoint_incremental_bytes)
+
+    # Keep updating the object until the checkpoint server has written some
+    # of it between checkpoints.
+    def test_checkpoint_incremental(self):
+        simple_populate(self, self.uri, 'leaf_page_max=4KB', self.nentries)
+        cursor = self.session.open_cursor(self.uri, None)
+        for i in range(100):
+            if self.incremental_bytes() > 0:
+                break
+            for j in range(1, self.nentries + 1, 10):
+                cursor.set_key(key_populate(cursor, j))
+                cursor.set_value(str(i) + ': update')
+                cursor.update()
+            time.sleep(0.1)
+        cursor.close()
+        self.assertGreater(self.incremental_bytes(), 0)
+
+        self.reopen_conn()
+        self.session.verify(self.uri)
+
+if __name__ == '__main__':
+    wttest.run()
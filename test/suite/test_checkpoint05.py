@@ -0,0 +1,55 @@
+#!/usr/bin/env python
+#
+# Public Domain 2008-2013 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import wiredtiger, wttest
+from helper import simple_populate, stat_value
+from wiredtiger import stat
+
+# test_checkpoint05.py
+#    Checkpoint writes are throttled to the configured rate
+class test_checkpoint05(wttest.WiredTigerTestCase):
+    nentries = 50000
+    conn_config = 'checkpoint=(max_mb_per_sec=1),statistics=(fast)'
+    scenarios = [
+        ('file', dict(uri='file:checkpoint')),
+        ('table', dict(uri='table:checkpoint')),
+        ]
+
+    # Write more than a second's worth of data at the configured rate, and
+    # check the checkpoint waited and the object is still correct.
+    def test_checkpoint_throttle(self):
+        simple_populate(self, self.uri, 'key_format=S', self.nentries)
+        self.session.checkpoint()
+        self.assertGreater(stat_value(self, stat.conn.block_ckpt_throttle), 0)
+        self.assertGreater(
+            stat_value(self, stat.conn.block_ckpt_throttle_time), 0)
+
+        self.reopen_conn()
+        self.session.verify(self.uri)
+
+if __name__ == '__main__':
+    wttest.run()
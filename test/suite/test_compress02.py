@@ -0,0 +1,106 @@
+#!/usr/bin/env python
+#
+# Public Domain 2008-2013 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+# test_compress02.py
+#   Log record compression
+#
+
+import os, run
+import wiredtiger, wttest
+from wiredtiger import stat
+from helper import stat_value
+from wtscenario import multiply_scenarios, number_scenarios
+
+# Test log record compression
+class test_compress02(wttest.WiredTigerTestCase):
+
+    compress = [
+        ('bzip2', dict(compress='bzip2')),
+        ('nop', dict(compress='nop')),
+        ('snappy', dict(compress='snappy')),
+    ]
+    scenarios = number_scenarios(multiply_scenarios('.', compress))
+
+    uri = 'table:test_compress02'
+    nrecords = 1000
+    bigvalue = "abcdefghij" * 100
+
+    # Override WiredTigerTestCase, we have extensions.
+    def setUpConnectionOpen(self, dir):
+        self.home = dir
+        conn = wiredtiger.wiredtiger_open(dir, 'create,' +
+            ('error_prefix="%s: ",' % self.shortid()) +
+            'statistics=(fast),' + self.logArg())
+        self.pr(`conn`)
+        return conn
+
+    # Return the wiredtiger_open log and extension arguments.
+    def logArg(self):
+        testdir = os.path.dirname(__file__)
+        extdir = os.path.join(run.wt_builddir, 'ext/compressors')
+        extfile = os.path.join(extdir,
+            self.compress, '.libs', 'libwiredtiger_' + self.compress + '.so')
+        if not os.path.exists(extfile):
+            self.skipTest('compression extension "' + extfile + '" not built')
+        return 'log=(enabled,compressor=' + self.compress + '),' + \
+            'extensions=["' + extfile + '"]'
+
+    # Add keys with big values, then check recovery reads them back from the
+    # compressed log.
+    def test_compress_log(self):
+        self.session.create(self.uri, 'key_format=S,value_format=S')
+        cursor = self.session.open_cursor(self.uri, None)
+        for idx in xrange(1, self.nrecords):
+            cursor.set_key(`idx`)
+            cursor.set_value(`idx` + self.bigvalue)
+            cursor.insert()
+        cursor.close()
+
+        # The nop compressor never makes records smaller.
+        compressed = stat_value(self, stat.conn.log_compress_writes)
+        if self.compress == 'nop':
+            self.assertEqual(compressed, 0)
+        else:
+            self.assertGreater(compressed, 0)
+
+        # Opening a copy of the database runs recovery from the log.
+        backup_dir = os.path.join(self.home, "WT_BACKUP")
+        self.backup(backup_dir)
+        backup_conn = wiredtiger.wiredtiger_open(backup_dir, self.logArg())
+        try:
+            cursor = backup_conn.open_session().open_cursor(self.uri, None)
+            for idx in xrange(1, self.nrecords):
+                cursor.set_key(`idx`)
+                self.assertEqual(cursor.search(), 0)
+                self.assertEquals(cursor.get_value(), `idx` + self.bigvalue)
+            cursor.close()
+        finally:
+            backup_conn.close()
+
+
+if __name__ == '__main__':
+    wttest.run()
@@ -150,6 +150,27 @@ class test_config04(wttest.WiredTigerTestCase):
                                        'eviction_trigger=86'),
             "/eviction target must be lower than the eviction trigger/")
 
+    def test_eviction_threads(self):
+        self.common_test('eviction=(threads_min=2,threads_max=4)')
+
+    def test_eviction_threads_bad(self):
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError, lambda:
+            wiredtiger.wiredtiger_open('.', 'create,' +
+                                       'eviction=(threads_min=4,threads_max=2)'),
+            "/must not be larger than/")
+
+    def test_eviction_scan_resistant(self):
+        self.common_test('eviction=(scan_resistant=true)')
+
+    def test_write_behind(self):
+        self.common_test('write_behind=(threads=2)')
+
+    def test_write_behind_bad(self):
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError, lambda:
+            wiredtiger.wiredtiger_open('.', 'create,' +
+                                       'write_behind=(threads=9)'),
+            "/Value too large for key/")
+
     def test_hazard_max(self):
         # Note: There isn't any direct way to know that this was set.
         self.common_test('hazard_max=50')
@@ -173,6 +194,31 @@ class test_config04(wttest.WiredTigerTestCase):
         # TODO: how do we verify that it was set?  For this we could look
         # for the existence of the log file in the home dir.
 
+    def test_logging_group_commit(self):
+        self.common_test('log=(enabled=true,group_commit_usecs=100),' +
+            'transaction_sync=fsync')
+
+    def test_logging_group_commit_bad(self):
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError, lambda:
+            wiredtiger.wiredtiger_open('.', 'create,' +
+                'log=(enabled=true,group_commit_usecs=2000000)'),
+            "/Value too large for key/")
+
+    def test_logging_compressor_bad(self):
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError, lambda:
+            wiredtiger.wiredtiger_open('.', 'create,' +
+                'log=(enabled=true,compressor=not_a_compressor)'),
+            "/unknown log compressor/")
+
+    def test_logging_prealloc(self):
+        self.common_test('log=(enabled=true,file_max=100K,prealloc=2)')
+
+    def test_logging_prealloc_bad(self):
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError, lambda:
+            wiredtiger.wiredtiger_open('.', 'create,' +
+                'log=(enabled=true,prealloc=17)'),
+            "/Value too large for key/")
+
     def test_transactional(self):
         # Note: this will have functional tests in the future.
         self.common_test('')
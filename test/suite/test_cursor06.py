@@ -0,0 +1,90 @@
+#!/usr/bin/env python
+#
+# Public Domain 2008-2013 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+
+import wiredtiger, wttest
+from helper import stat_value
+from wiredtiger import stat
+from wtscenario import number_scenarios
+
+# test_cursor06.py
+#    Cursors inserting increasing keys into the same pages, interleaved with
+# each other and with inserts of smaller keys.
+class test_cursor06(wttest.WiredTigerTestCase):
+    nseries = 5
+    nentries = 2000
+    conn_config = 'statistics=(fast)'
+    scenarios = number_scenarios([
+        ('file', dict(type='file:')),
+        ('table', dict(type='table:'))
+        ])
+
+    def key(self, series, i):
+        return 'series' + str(series) + '-' + str(i).zfill(8)
+
+    # Each cursor inserts a series of increasing keys, the cursors take turns.
+    # Another cursor fills in the gaps each series leaves, going backward,
+    # and overwrites keys the series cursors inserted.  Checkpoint part way
+    # through, the series continue on the reconciled page.
+    def test_cursor_finger(self):
+        uri = self.type + 'cursor_finger'
+        self.session.create(uri, 'key_format=S,value_format=S')
+        cursors = [self.session.open_cursor(uri, None, None)
+            for series in range(self.nseries)]
+        other = self.session.open_cursor(uri, None, None)
+        expect = {}
+        for i in range(0, self.nentries, 2):
+            for series in range(self.nseries):
+                cursors[series].set_key(self.key(series, i))
+                cursors[series].set_value(str(i))
+                cursors[series].insert()
+                expect[self.key(series, i)] = str(i)
+            if i % 10 == 8:
+                for j in range(i - 1, i - 10, -2):
+                    other.set_key(self.key(i % self.nseries, j))
+                    other.set_value(str(j))
+                    other.insert()
+                    expect[self.key(i % self.nseries, j)] = str(j)
+                other.set_key(self.key(0, i))
+                other.set_value('overwrite')
+                other.insert()
+                expect[self.key(0, i)] = 'overwrite'
+            if i == self.nentries / 2:
+                self.session.checkpoint()
+        for c in cursors:
+            c.close()
+        other.close()
+        self.assertGreater(
+            stat_value(self, stat.conn.cursor_insert_finger), 0)
+
+        cursor = self.session.open_cursor(uri, None, None)
+        self.assertEqual([(k, v) for k, v in cursor], sorted(expect.items()))
+        cursor.close()
+        self.session.verify(uri)
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,107 @@
+#!/usr/bin/env python
+#
+# Public Domain 2008-2013 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import wiredtiger, wttest
+from helper import simple_populate, key_populate, stat_value
+from wiredtiger import stat
+
+# test_cursor07.py
+#    Cursors configured with the scan hint, in a scan-resistant cache
+class test_cursor07(wttest.WiredTigerTestCase):
+    nentries = 10000
+    config = 'allocation_size=512,leaf_page_max=512,key_format=S'
+    conn_config = 'cache_size=1MB,eviction=(scan_resistant=true),' + \
+        'statistics=(fast)'
+    scenarios = [
+        ('file', dict(type='file:')),
+        ('table', dict(type='table:'))
+        ]
+
+    # Scan cursors return every record, forward and backward, from pages
+    # read into the cache by the scan.
+    def test_cursor_scan(self):
+        uri = self.type + 'scan'
+        simple_populate(self, uri, self.config, self.nentries)
+        self.reopen_conn()
+
+        cursor = self.session.open_cursor(uri, None, 'scan=true')
+        count = 0
+        while cursor.next() == 0:
+            count += 1
+        self.assertEqual(count, self.nentries)
+
+        count = 0
+        while cursor.prev() == 0:
+            count += 1
+        self.assertEqual(count, self.nentries)
+
+        # Scan cursors support searches like any other cursor.
+        cursor.set_key(key_populate(cursor, 37))
+        self.assertEqual(cursor.search(), 0)
+        cursor.close()
+
+    # Search a hot set of records.
+    def search_hot(self, uri):
+        cursor = self.session.open_cursor(uri, None, None)
+        for i in range(20000, 20200):
+            cursor.set_key(key_populate(cursor, i))
+            self.assertEqual(cursor.search(), 0)
+        cursor.close()
+
+    # A scan of a table much larger than the cache doesn't push a hot set of
+    # pages out of the cache: the pages stay protected, and searching the hot
+    # set after the scan doesn't read any pages.
+    def test_cursor_scan_hot(self):
+        uri = self.type + 'scan'
+        simple_populate(self, uri, self.config, 50000)
+        self.reopen_conn()
+
+        # The second search of the hot set uses the pages the first one
+        # read, which moves them to the protected part of the cache.
+        self.search_hot(uri)
+        self.search_hot(uri)
+        protected = stat_value(self, stat.conn.cache_bytes_protected)
+        self.assertGreater(protected, 0)
+        self.assertGreater(stat_value(self, stat.conn.cache_pages_protected), 0)
+
+        reads = stat_value(self, stat.conn.cache_read)
+        cursor = self.session.open_cursor(uri, None, 'scan=true')
+        count = 0
+        while cursor.next() == 0:
+            count += 1
+        cursor.close()
+        self.assertEqual(count, 50000)
+        scan_reads = stat_value(self, stat.conn.cache_read)
+        self.assertGreater(scan_reads, reads)
+
+        self.search_hot(uri)
+        self.assertEqual(stat_value(self, stat.conn.cache_read), scan_reads)
+        self.assertEqual(
+            stat_value(self, stat.conn.cache_bytes_protected), protected)
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,103 @@
+#!/usr/bin/env python
+#
+# Public Domain 2008-2013 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+
+import wiredtiger, wttest
+from helper import simple_populate, stat_value
+from wiredtiger import stat
+from wtscenario import multiply_scenarios, number_scenarios
+
+# test_cursor08.py
+#    Cursor scans of objects configured for read-ahead
+class test_cursor08(wttest.WiredTigerTestCase):
+    nentries = 10000
+    config = 'allocation_size=512,leaf_page_max=512,'
+    types = [
+        ('file-r', dict(type='file:', keyfmt='r')),
+        ('file-S', dict(type='file:', keyfmt='S')),
+        ('table-r', dict(type='table:', keyfmt='r')),
+        ('table-S', dict(type='table:', keyfmt='S'))
+        ]
+    readers = [
+        ('os', dict(prefetch=False, conn_config='statistics=(fast)')),
+        ('prefetch', dict(prefetch=True,
+            conn_config='prefetch=(threads=2),statistics=(fast)'))
+        ]
+    scenarios = number_scenarios(multiply_scenarios('.', types, readers))
+
+    # Return an object's records, in the order a scan returns them.
+    def scan(self, uri, direction):
+        cursor = self.session.open_cursor(uri, None, None)
+        records = []
+        while (cursor.next() if direction == 'next' else cursor.prev()) == 0:
+            records.append((cursor.get_key(), cursor.get_value()))
+        cursor.close()
+        return records
+
+    # Scans read ahead of the cursor and return the same records, forward
+    # and backward, as scans of an object without read-ahead.
+    def test_cursor_read_ahead(self):
+        uri = self.type + 'read_ahead'
+        base_uri = self.type + 'base'
+        simple_populate(self, uri, self.config +
+            'read_ahead=16,key_format=' + self.keyfmt, self.nentries)
+        simple_populate(self, base_uri,
+            self.config + 'key_format=' + self.keyfmt, self.nentries)
+
+        for direction in ('next', 'prev'):
+            self.reopen_conn()
+            expected = self.scan(base_uri, direction)
+            self.assertEqual(len(expected), self.nentries)
+            self.assertEqual(stat_value(self, stat.conn.cache_read_ahead), 0)
+
+            self.assertEqual(self.scan(uri, direction), expected)
+            self.assertGreater(
+                stat_value(self, stat.dsrc.cache_read_ahead, uri), 0)
+            self.assertEqual(
+                stat_value(self, stat.dsrc.cache_read_ahead, base_uri), 0)
+
+            # Prefetch threads read the pages into the cache, where the
+            # scan finds them.
+            if self.prefetch:
+                self.assertGreater(
+                    stat_value(self, stat.conn.cache_prefetch_read), 0)
+                self.assertGreater(
+                    stat_value(self, stat.conn.cache_prefetch_used), 0)
+
+    # Without read-ahead configured, scans don't read ahead.
+    def test_cursor_read_ahead_off(self):
+        uri = self.type + 'read_ahead'
+        simple_populate(self, uri,
+            self.config + 'key_format=' + self.keyfmt, self.nentries)
+        self.reopen_conn()
+
+        self.assertEqual(len(self.scan(uri, 'next')), self.nentries)
+        self.assertEqual(stat_value(self, stat.conn.cache_read_ahead), 0)
+        self.assertEqual(stat_value(self, stat.conn.cache_prefetch_queued), 0)
+
+if __name__ == '__main__':
+    wttest.run()
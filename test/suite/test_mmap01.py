@@ -0,0 +1,80 @@
+#!/usr/bin/env python
+#
+# Public Domain 2008-2013 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import wiredtiger, wttest
+from helper import key_populate, simple_populate, simple_populate_check, \
+    stat_value
+from wiredtiger import stat
+
+# test_mmap01.py
+#    Blocks of live objects are read through the file's memory map, and the
+#    map follows the file as it grows.
+class test_mmap01(wttest.WiredTigerTestCase):
+    nentries = 30000
+    scenarios = [
+        ('mmap', dict(mmap=True,
+            conn_config='cache_size=1MB,statistics=(fast)')),
+        ('no-mmap', dict(mmap=False,
+            conn_config='cache_size=1MB,mmap=false,statistics=(fast)'))
+        ]
+
+    def test_mmap(self):
+        uri = 'file:mmap'
+        simple_populate(self, uri,
+            'leaf_page_max=4KB,key_format=r', self.nentries)
+        self.reopen_conn()
+        simple_populate_check(self, uri, self.nentries)
+        mapped = stat_value(self, stat.conn.block_map_read)
+        if self.mmap:
+            self.assertGreater(mapped, 0)
+            self.assertEqual(stat_value(self, stat.conn.block_read), 0)
+        else:
+            self.assertEqual(mapped, 0)
+            self.assertGreater(stat_value(self, stat.conn.block_read), 0)
+
+        # Grow the file and read it again, the new blocks must come from
+        # the extended map.
+        cursor = self.session.open_cursor(uri, None, None)
+        for i in range(self.nentries + 1, self.nentries * 20 + 1):
+            cursor.set_key(key_populate(cursor, i))
+            cursor.set_value(str(i) + ': ' + 'abcdefghijklmnopqrstuvwxyz' * 4)
+            cursor.insert()
+        cursor.close()
+        self.session.checkpoint()
+        cursor = self.session.open_cursor(uri, None, None)
+        self.assertEqual(sum(1 for _ in cursor), self.nentries * 20)
+        cursor.close()
+        if self.mmap:
+            self.assertGreater(
+                stat_value(self, stat.conn.block_map_read), mapped)
+            self.assertEqual(stat_value(self, stat.conn.block_read), 0)
+        else:
+            self.assertEqual(stat_value(self, stat.conn.block_remap), 0)
+        self.session.verify(uri)
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,123 @@
+#!/usr/bin/env python
+#
+# Public Domain 2008-2013 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import wiredtiger, wttest
+from helper import simple_populate, key_populate, stat_value
+from wiredtiger import stat
+
+# test_prefetch01.py
+#    Prefetch threads and WT_SESSION::prefetch
+class test_prefetch01(wttest.WiredTigerTestCase):
+    nentries = 10000
+    config = 'allocation_size=512,leaf_page_max=512,'
+    conn_config = 'prefetch=(threads=2),statistics=(fast)'
+    scenarios = [
+        ('file-r', dict(type='file:', keyfmt='r')),
+        ('file-S', dict(type='file:', keyfmt='S')),
+        ('table-r', dict(type='table:', keyfmt='r')),
+        ('table-S', dict(type='table:', keyfmt='S'))
+        ]
+
+    def check(self, uri):
+        cursor = self.session.open_cursor(uri, None, None)
+        i = 1
+        while cursor.next() == 0:
+            self.assertEqual(cursor.get_key(), key_populate(cursor, i))
+            i += 1
+        self.assertEqual(i, self.nentries + 1)
+        cursor.close()
+
+    # Prefetch a whole object, then read it.
+    def test_prefetch_object(self):
+        uri = self.type + 'prefetch'
+        simple_populate(self, uri,
+            self.config + 'key_format=' + self.keyfmt, self.nentries)
+        self.reopen_conn()
+
+        self.session.prefetch(uri, None, None, None)
+        self.assertGreater(
+            stat_value(self, stat.conn.cache_prefetch_queued), 0)
+        self.check(uri)
+
+    # Prefetch a cursor range, then read the object.
+    def test_prefetch_range(self):
+        uri = self.type + 'prefetch'
+        simple_populate(self, uri,
+            self.config + 'key_format=' + self.keyfmt, self.nentries)
+        self.reopen_conn()
+
+        start = self.session.open_cursor(uri, None, None)
+        start.set_key(key_populate(start, 100))
+        stop = self.session.open_cursor(uri, None, None)
+        stop.set_key(key_populate(stop, 5000))
+        self.session.prefetch(None, start, stop, None)
+        start.close()
+        stop.close()
+        self.assertGreater(
+            stat_value(self, stat.conn.cache_prefetch_queued), 0)
+        self.check(uri)
+
+        # Prefetch with only one end of the range, or an empty range.
+        start = self.session.open_cursor(uri, None, None)
+        start.set_key(key_populate(start, 9000))
+        self.session.prefetch(None, start, None, None)
+        stop = self.session.open_cursor(uri, None, None)
+        stop.set_key(key_populate(stop, 10))
+        self.session.prefetch(None, None, stop, None)
+        self.session.prefetch(None, start, stop, None)
+        start.close()
+        stop.close()
+        self.check(uri)
+
+    # Cursor scans configured for read-ahead use the prefetch threads.
+    def test_prefetch_read_ahead(self):
+        uri = self.type + 'prefetch'
+        simple_populate(self, uri, self.config +
+            'read_ahead=16,key_format=' + self.keyfmt, self.nentries)
+        self.reopen_conn()
+
+        self.check(uri)
+        self.assertGreater(stat_value(self, stat.conn.cache_read_ahead), 0)
+        self.assertGreater(
+            stat_value(self, stat.conn.cache_prefetch_queued), 0)
+
+    # Prefetch requires either a URI or cursors.
+    def test_prefetch_args(self):
+        uri = self.type + 'prefetch'
+        simple_populate(self, uri,
+            self.config + 'key_format=' + self.keyfmt, self.nentries)
+        msg = '/either a URI or start/stop cursors/'
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: self.session.prefetch(None, None, None, None), msg)
+        cursor = self.session.open_cursor(uri, None, None)
+        cursor.set_key(key_populate(cursor, 10))
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: self.session.prefetch(uri, cursor, None, None), msg)
+        cursor.close()
+
+if __name__ == '__main__':
+    wttest.run()
@@ -34,6 +34,21 @@ class test_reconfig(wttest.WiredTigerTestCase):
     def test_reconfig_shared_cache(self):
         self.conn.reconfigure("shared_cache=(enable=true,size=300M)")
 
+    def test_reconfig_eviction(self):
+        self.conn.reconfigure("eviction=(threads_min=2,threads_max=4)")
+        self.conn.reconfigure("eviction=(threads_max=8)")
+        self.conn.reconfigure("eviction=(threads_min=1,threads_max=1)")
+
+    def test_reconfig_eviction_scan_resistant(self):
+        self.conn.reconfigure("eviction=(scan_resistant=true)")
+        self.conn.reconfigure("eviction=(scan_resistant=false)")
+
+    def test_reconfig_eviction_bad(self):
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: self.conn.reconfigure(
+            "eviction=(threads_min=4,threads_max=2)"),
+            "/must not be larger than/")
+
     def test_reconfig_statistics(self):
         self.conn.reconfigure("statistics=(all)")
         self.conn.reconfigure("statistics=(fast)")
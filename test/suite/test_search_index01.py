@@ -0,0 +1,102 @@
+#!/usr/bin/env python
+#
+# Public Domain 2008-2013 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+
+import wiredtiger, wttest
+from helper import stat_value
+from wiredtiger import stat
+from wtscenario import multiply_scenarios, number_scenarios
+
+# test_search_index01.py
+#    Searches of leaf pages with hash indexes
+class test_search_index01(wttest.WiredTigerTestCase):
+    nentries = 30000
+    conn_config = 'statistics=(fast)'
+    types = [
+        ('file', dict(type='file:')),
+        ('table', dict(type='table:'))
+        ]
+    keys = [
+        ('mixed', dict(numeric=False)),
+        ('numeric', dict(numeric=True))
+        ]
+    scenarios = number_scenarios(
+        multiply_scenarios('.', types, keys))
+
+    # Keys of varying lengths sharing leading bytes, or fixed-width numeric
+    # keys, where the keys on a page share their leading zeroes.
+    def key(self, i):
+        if self.numeric:
+            return str(i).zfill(20)
+        if i % 3 == 0:
+            return 'prefix__' + str(i).zfill(8)
+        if i % 3 == 1:
+            return str(i)
+        return str(i).zfill(8) + 'tail'
+
+    # Search for every other key after reading the tree from disk, the
+    # leaf pages get hash indexes once they've been searched enough.  Keys
+    # inserted after the index is built are found by binary search.
+    def test_search_index(self):
+        uri = self.type + 'search_index'
+        self.session.create(uri, 'key_format=S,value_format=S,' +
+            'internal_page_max=2KB,leaf_page_max=2KB,leaf_hash_index=true')
+        cursor = self.session.open_cursor(uri, None, None)
+        for i in range(0, self.nentries, 2):
+            cursor.set_key(self.key(i))
+            cursor.set_value(str(i))
+            cursor.insert()
+        cursor.close()
+        self.reopen_conn()
+
+        cursor = self.session.open_cursor(uri, None, None)
+        for i in range(self.nentries):
+            cursor.set_key(self.key(i))
+            if i % 2 == 0:
+                self.assertEqual(cursor.search(), 0)
+                self.assertEqual(cursor.get_value(), str(i))
+            else:
+                self.assertEqual(cursor.search(), wiredtiger.WT_NOTFOUND)
+        self.assertGreater(
+            stat_value(self, stat.conn.cache_leaf_hash), 0)
+
+        for i in range(1, self.nentries, 4):
+            cursor.set_key(self.key(i))
+            cursor.set_value(str(i))
+            cursor.insert()
+        for i in range(self.nentries):
+            cursor.set_key(self.key(i))
+            if i % 2 == 0 or i % 4 == 1:
+                self.assertEqual(cursor.search(), 0)
+                self.assertEqual(cursor.get_value(), str(i))
+            else:
+                self.assertEqual(cursor.search(), wiredtiger.WT_NOTFOUND)
+        cursor.close()
+        self.session.verify(uri)
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,141 @@
+#!/usr/bin/env python
+#
+# Public Domain 2008-2013 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+# test_txn06.py
+# Transactions: parallel recovery
+#
+
+import os, shutil
+from wiredtiger import wiredtiger_open
+from wtscenario import multiply_scenarios, number_scenarios
+import wttest
+
+class test_txn06(wttest.WiredTigerTestCase):
+    logmax = "100K"
+    nentries = 1000
+    ntables = 5
+
+    types = [
+        ('row', dict(tabletype='row',
+                    create_params = 'key_format=i,value_format=S')),
+        ('var', dict(tabletype='var',
+                    create_params = 'key_format=r,value_format=S')),
+    ]
+    threads = [
+        ('threads1', dict(recovery_threads=1)),
+        ('threads3', dict(recovery_threads=3)),
+        ('threads8', dict(recovery_threads=8)),
+    ]
+
+    scenarios = number_scenarios(multiply_scenarios('.', types, threads))
+
+    # Overrides WiredTigerTestCase
+    def setUpConnectionOpen(self, dir):
+        self.home = dir
+        conn_params = \
+                'log=(archive=false,enabled,file_max=%s),' % self.logmax + \
+                'create,error_prefix="%s: ",' % self.shortid() + \
+                'transaction_sync="none"'
+        conn = wiredtiger_open(dir, conn_params)
+        self.pr(`conn`)
+        return conn
+
+    def uri(self, i):
+        return 'table:test_txn06.%d' % i
+
+    # Return the contents of all of the tables in a database.
+    def contents(self, home, conn_params):
+        conn = wiredtiger_open(home, conn_params)
+        try:
+            session = conn.open_session()
+            result = []
+            for i in range(self.ntables):
+                c = session.open_cursor(self.uri(i), None)
+                result.append([(k, v) for k, v in c])
+                c.close()
+        finally:
+            conn.close()
+        return result
+
+    # Recovering a copy of the database with parallel recovery should give
+    # the same results as serial recovery.
+    def test_recovery_parallel(self):
+        for i in range(self.ntables):
+            self.session.create(self.uri(i), self.create_params)
+
+        # Checkpoint some of the changes, so recovery skips them.
+        self.session.checkpoint()
+        cursors = [self.session.open_cursor(self.uri(i), None)
+            for i in range(self.ntables)]
+        for j in range(1, self.nentries):
+            if j == self.nentries / 2:
+                self.session.checkpoint()
+            c = cursors[j % self.ntables]
+            c.set_key(j % 100 + 1)
+            c.set_value(str(j) * (j % 20 + 1))
+            c.insert()
+            if j % 7 == 0:
+                c.set_key(j % 100 + 1)
+                c.remove()
+
+        # Transactions with operations on several tables, one rolled back.
+        for txn in ['commit', 'rollback', 'commit']:
+            self.session.begin_transaction()
+            for c in cursors:
+                c.set_key(1000)
+                c.set_value(txn)
+                c.insert()
+            if txn == 'commit':
+                self.session.commit_transaction()
+            else:
+                self.session.rollback_transaction()
+
+        # Truncate part of one of the tables.
+        start = self.session.open_cursor(self.uri(0), None)
+        start.set_key(10)
+        stop = self.session.open_cursor(self.uri(0), None)
+        stop.set_key(30)
+        self.session.truncate(None, start, stop, None)
+        start.close()
+        stop.close()
+        for c in cursors:
+            c.close()
+
+        # Recover two copies of the database.
+        serial_dir = os.path.join(self.home, "SERIAL")
+        parallel_dir = os.path.join(self.home, "PARALLEL")
+        self.backup(serial_dir)
+        shutil.rmtree(parallel_dir, ignore_errors=True)
+        shutil.copytree(serial_dir, parallel_dir)
+
+        serial = self.contents(serial_dir, 'log=(enabled)')
+        parallel = self.contents(parallel_dir,
+            'log=(enabled,recovery_threads=%d)' % self.recovery_threads)
+        self.assertEqual(serial, parallel)
+
+if __name__ == '__main__':
+    wttest.run()
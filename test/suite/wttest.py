@@ -188,9 +188,15 @@ class WiredTigerTestCase(unittest.TestCase):
         return "%s.%s.%s" %  (self.__module__,
                               self.className(), self._testMethodName)
 
+    # Additional connection configuration, can be set by subclasses
+    conn_config = ''
+
     # Can be overridden
     def setUpConnectionOpen(self, dir):
-        conn = wiredtiger.wiredtiger_open(dir, 'create,error_prefix="' +
+        config = 'create,'
+        if self.conn_config != '':
+            config += self.conn_config + ','
+        conn = wiredtiger.wiredtiger_open(dir, config + 'error_prefix="' +
                                           self.shortid() + ': ' + '"')
         self.pr(`conn`)
         return conn
@@ -0,0 +1,221 @@
+/*-
+ * Public Domain 2008-2013 WiredTiger, Inc.
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "thread.h"
+
+static void  insert_check(void);
+static void *inserter(void *);
+
+static u_int ninserters;			/* Inserting threads */
+
+/*
+ * insert_start --
+ *	Insert records from concurrent threads, then check none were lost.
+ */
+int
+insert_start(u_int inserters)
+{
+	struct timeval start, stop;
+	double seconds;
+	pthread_t *tids;
+	u_int i;
+	int ret;
+	void *thread_ret;
+
+	ninserters = inserters;
+	if (ninserters == 0)
+		return (0);
+
+	if ((tids = calloc((size_t)ninserters, sizeof(*tids))) == NULL)
+		die("calloc", errno);
+
+	(void)gettimeofday(&start, NULL);
+
+	/* Create threads. */
+	for (i = 0; i < ninserters; ++i)
+		if ((ret = pthread_create(
+		    &tids[i], NULL, inserter, (void *)(uintptr_t)i)) != 0)
+			die("pthread_create", ret);
+
+	/* Wait for the threads. */
+	for (i = 0; i < ninserters; ++i)
+		(void)pthread_join(tids[i], &thread_ret);
+
+	(void)gettimeofday(&stop, NULL);
+	seconds = (stop.tv_sec - start.tv_sec) +
+	    (stop.tv_usec - start.tv_usec) * 1e-6;
+	fprintf(stderr, "timer: %.2lf seconds (%d inserts/second)\n",
+	    seconds, (int)((ninserters * nops) / seconds));
+
+	free(tids);
+
+	insert_check();
+	return (0);
+}
+
+/*
+ * inserter_op --
+ *	Insert operation.
+ *
+ * Row-store threads alternate between appending keys past the end of the
+ * loaded records, interleaved with every other thread's appends, and
+ * inserting keys between loaded records.  Column-store threads append.
+ */
+static inline void
+inserter_op(WT_CURSOR *cursor, u_int id, u_int i)
+{
+	WT_ITEM *key, _key, *value, _value;
+	int ret;
+	char keybuf[64], valuebuf[64];
+
+	key = &_key;
+	value = &_value;
+
+	if (ftype == ROW) {
+		key->data = keybuf;
+		if (i % 2 == 0)
+			key->size = (uint32_t)snprintf(keybuf,
+			    sizeof(keybuf), "%017u",
+			    nkeys + 1 + (i / 2) * ninserters + id);
+		else
+			key->size = (uint32_t)snprintf(keybuf,
+			    sizeof(keybuf), "%017u.%03u.%010u",
+			    (i / 2) % nkeys + 1, id, i);
+		cursor->set_key(cursor, key);
+	}
+	value->data = valuebuf;
+	if (ftype == FIX)
+		cursor->set_value(cursor, 0x02);
+	else {
+		value->size = (uint32_t)snprintf(
+		    valuebuf, sizeof(valuebuf), "insert %3u %10u", id, i);
+		cursor->set_value(cursor, value);
+	}
+	if ((ret = cursor->insert(cursor)) != 0)
+		die("cursor.insert", ret);
+}
+
+/*
+ * inserter --
+ *	Inserter thread start function.
+ */
+static void *
+inserter(void *arg)
+{
+	WT_CURSOR *cursor;
+	WT_SESSION *session;
+	pthread_t tid;
+	u_int i, id;
+	int ret;
+
+	id = (u_int)(uintptr_t)arg;
+	tid = pthread_self();
+	printf("insert thread %2u starting: tid: %p\n", id, (void *)tid);
+	sched_yield();		/* Get all the threads created. */
+
+	if ((ret = conn->open_session(conn, NULL, NULL, &session)) != 0)
+		die("conn.open_session", ret);
+	if ((ret = session->open_cursor(session, FNAME,
+	    NULL, ftype == ROW ? NULL : "append", &cursor)) != 0)
+		die("session.open_cursor", ret);
+	for (i = 0; i < nops; ++i)
+		inserter_op(cursor, id, i);
+	if ((ret = session->close(session, NULL)) != 0)
+		die("session.close", ret);
+
+	return (NULL);
+}
+
+/*
+ * insert_check --
+ *	Walk the file, checking every record is there and in order.
+ */
+static void
+insert_check(void)
+{
+	WT_CURSOR *cursor;
+	WT_ITEM key, last;
+	WT_SESSION *session;
+	uint64_t count, recno, last_recno;
+	size_t len;
+	int cmp, ret;
+	char lastbuf[64];
+
+	if ((ret = conn->open_session(conn, NULL, NULL, &session)) != 0)
+		die("conn.open_session", ret);
+	if ((ret = session->open_cursor(
+	    session, FNAME, NULL, NULL, &cursor)) != 0)
+		die("session.open_cursor", ret);
+
+	count = last_recno = 0;
+	last.size = 0;
+	while ((ret = cursor->next(cursor)) == 0) {
+		++count;
+		if (ftype == ROW) {
+			if ((ret = cursor->get_key(cursor, &key)) != 0)
+				die("cursor.get_key", ret);
+			len = last.size < key.size ? last.size : key.size;
+			if (count > 1 &&
+			    ((cmp = memcmp(last.data, key.data, len)) > 0 ||
+			    (cmp == 0 && last.size >= key.size))) {
+				fprintf(stderr,
+				    "insert check: keys out of order: "
+				    "%.*s >= %.*s\n",
+				    (int)last.size, (char *)last.data,
+				    (int)key.size, (char *)key.data);
+				exit(EXIT_FAILURE);
+			}
+			memcpy(lastbuf, key.data, key.size);
+			last.data = lastbuf;
+			last.size = key.size;
+		} else {
+			if ((ret = cursor->get_key(cursor, &recno)) != 0)
+				die("cursor.get_key", ret);
+			if (recno != last_recno + 1) {
+				fprintf(stderr,
+				    "insert check: record %" PRIu64
+				    " follows record %" PRIu64 "\n",
+				    recno, last_recno);
+				exit(EXIT_FAILURE);
+			}
+			last_recno = recno;
+		}
+	}
+	if (ret != WT_NOTFOUND)
+		die("cursor.next", ret);
+
+	if (count != (uint64_t)nkeys + (uint64_t)ninserters * nops) {
+		fprintf(stderr,
+		    "insert check: found %" PRIu64 " records, expected %"
+		    PRIu64 "\n",
+		    count, (uint64_t)nkeys + (uint64_t)ninserters * nops);
+		exit(EXIT_FAILURE);
+	}
+
+	if ((ret = session->close(session, NULL)) != 0)
+		die("session.close", ret);
+}
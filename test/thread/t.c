@@ -47,7 +47,7 @@ static void wt_shutdown(void);
 int
 main(int argc, char *argv[])
 {
-	u_int readers, writers;
+	u_int inserters, readers, writers;
 	int ch, cnt, runs;
 	char *config_open;
 
@@ -58,6 +58,7 @@ main(int argc, char *argv[])
 
 	config_open = NULL;
 	ftype = ROW;
+	inserters = 10;
 	log_print = 0;
 	nkeys = 1000;
 	nops = 10000;
@@ -66,11 +67,14 @@ main(int argc, char *argv[])
 	session_per_op = 0;
 	writers = 10;
 
-	while ((ch = getopt(argc, argv, "C:k:Ll:n:R:r:St:W:")) != EOF)
+	while ((ch = getopt(argc, argv, "C:I:k:Ll:n:R:r:St:W:")) != EOF)
 		switch (ch) {
 		case 'C':			/* wiredtiger_open config */
 			config_open = optarg;
 			break;
+		case 'I':			/* inserting threads */
+			inserters = (u_int)atoi(optarg);
+			break;
 		case 'k':			/* rows */
 			nkeys = (u_int)atoi(optarg);
 			break;
@@ -128,14 +132,17 @@ main(int argc, char *argv[])
 
 	printf("%s: process %" PRIu64 "\n", progname, (uint64_t)getpid());
 	for (cnt = 1; runs == 0 || cnt <= runs; ++cnt) {
-		printf(
-		    "    %d: %u readers, %u writers\n", cnt, readers, writers);
+		printf("    %d: %u inserters, %u readers, %u writers\n",
+		    cnt, inserters, readers, writers);
 
 		shutdown();			/* Clean up previous runs */
 
 		wt_connect(config_open);	/* WiredTiger connection */
 
 		load();				/* Load initial records */
+						/* Concurrent inserts */
+		if (insert_start(inserters))
+			return (EXIT_FAILURE);
 						/* Loop operations */
 		if (rw_start(readers, writers))
 			return (EXIT_FAILURE);
@@ -265,11 +272,12 @@ usage(void)
 {
 	fprintf(stderr,
 	    "usage: %s "
-	    "[-S] [-C wiredtiger-config] [-k keys] [-l log]\n\t"
+	    "[-S] [-C wiredtiger-config] [-I inserters] [-k keys] [-l log]\n\t"
 	    "[-n ops] [-R readers] [-r runs] [-t f|r|v] [-W writers]\n",
 	    progname);
 	fprintf(stderr, "%s",
 	    "\t-C specify wiredtiger_open configuration arguments\n"
+	    "\t-I set number of inserting threads\n"
 	    "\t-k set number of keys to load\n"
 	    "\t-l specify a log file\n"
 	    "\t-n set number of operations each thread does\n"
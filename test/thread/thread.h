@@ -54,6 +54,7 @@ extern u_int nops;				/* Operations per thread */
 extern int   session_per_op;			/* New session per operation */
 
 void die(const char *, int) WT_GCC_ATTRIBUTE((noreturn));
+int  insert_start(u_int);
 void load(void);
 int  rw_start(u_int, u_int);
 void stats(void);
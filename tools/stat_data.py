@@ -1,15 +1,23 @@
 # DO NOT EDIT: automatically built by dist/stat.py. */
 
 no_scale_per_second_list = [
+    'block manager: block cache bytes currently held',
+    'I/O buffer pool: bytes currently held',
     'cache: tracked dirty bytes in the cache',
     'cache: bytes currently in the cache',
     'cache: maximum bytes configured',
+    'cache: bytes in the probationary part of the cache',
+    'cache: bytes in the protected part of the cache',
+    'cache: pages evicted by the busiest eviction worker thread',
+    'cache: pages evicted by the least busy eviction worker thread',
+    'cache: eviction worker threads currently running',
     'cache: tracked dirty pages in the cache',
     'cache: pages currently held in the cache',
     'files currently open',
     'log: total log buffer size',
     'open cursor count',
     'transaction checkpoint currently running',
+    'transaction recovery log file being replayed',
     'block manager: file allocation unit size',
     'block manager: checkpoint size',
     'block manager: file magic number',